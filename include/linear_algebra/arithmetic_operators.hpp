@@ -101,5 +101,169 @@ operator /(matrix<ET1, COT1> const& m1, S2 const& s2)
     return div_traits::divide(m1, s2);
 }
 
+
+//==================================================================================================
+//  Compound assignment operators, which update the elements of their left-hand operand in
+//  place rather than constructing a new matrix.  Dense operands having the same floating-point
+//  element type are updated by the SIMD kernels; all others are traversed in the order of the
+//  left-hand operand's layout.  A right-hand operand that refers to elements of the left-hand
+//  operand at different indices (e.g., A += A.t()) is first copied to a temporary.
+//==================================================================================================
+//
+template<class ET1, class COT1, class ET2, class COT2> inline constexpr
+matrix<ET1, COT1>&
+operator +=(matrix<ET1, COT1>& m1, matrix<ET2, COT2> const& m2)
+requires
+    detail::writable_matrix_engine<ET1>
+{
+    using support = detail::matrix_engine_support;
+
+    if (support::may_alias(m1.engine(), m2.engine()))
+    {
+        return m1.noalias() += matrix<detail::temporary_engine_t<ET2>, COT2>(m2);
+    }
+    return m1.noalias() += m2;
+}
+
+template<class ET1, class COT1, class ET2, class COT2> inline constexpr
+matrix<ET1, COT1>&
+operator -=(matrix<ET1, COT1>& m1, matrix<ET2, COT2> const& m2)
+requires
+    detail::writable_matrix_engine<ET1>
+{
+    using support = detail::matrix_engine_support;
+
+    if (support::may_alias(m1.engine(), m2.engine()))
+    {
+        return m1.noalias() -= matrix<detail::temporary_engine_t<ET2>, COT2>(m2);
+    }
+    return m1.noalias() -= m2;
+}
+
+//------
+//  A *= B requires that B be square, so that the product has the same extents as A.  It is
+//  computed one row at a time, using a copy of that row of A as its only workspace.  Since
+//  every row of A is read to compute each column of the product, B is first copied if it
+//  overlaps A at all.
+//
+template<class ET1, class COT1, class ET2, class COT2> inline constexpr
+matrix<ET1, COT1>&
+operator *=(matrix<ET1, COT1>& m1, matrix<ET2, COT2> const& m2)
+requires
+    detail::writable_matrix_engine<ET1>
+{
+    using support = detail::matrix_engine_support;
+
+    if (support::overlap(m1.engine(), m2.engine()))
+    {
+        return m1.noalias() *= matrix<detail::temporary_engine_t<ET2>, COT2>(m2);
+    }
+    return m1.noalias() *= m2;
+}
+
+template<class ET1, class COT1, class S2> inline constexpr
+matrix<ET1, COT1>&
+operator *=(matrix<ET1, COT1>& m1, S2 const& s2)
+requires
+    detail::writable_matrix_engine<ET1>
+{
+    scale(s2, m1);
+    return m1;
+}
+
+template<class ET1, class COT1, class S2> inline constexpr
+matrix<ET1, COT1>&
+operator /=(matrix<ET1, COT1>& m1, S2 const& s2)
+requires
+    detail::writable_matrix_engine<ET1>
+{
+    detail::blas_operation_support::divide_in_place(m1, s2);
+    return m1;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+//  Class Template:     matrix_noalias_proxy<ET, COT>
+//
+//  This class template is returned by matrix<ET, COT>::noalias().  Its assignment operators
+//  update the referenced matrix in place, in the same way as those of the matrix itself, but
+//  without first checking whether the right-hand operand overlaps the matrix; so no temporary
+//  is ever created.  The result is undefined if the operands do overlap.
+//--------------------------------------------------------------------------------------------------
+//
+template<class ET, class COT>
+class matrix_noalias_proxy
+{
+  public:
+    using matrix_type = matrix<ET, COT>;
+
+    explicit constexpr
+    matrix_noalias_proxy(matrix_type& m) noexcept
+    :   m_matrix(m)
+    {}
+
+    template<class ET2, class COT2>
+    constexpr matrix_type&
+    operator =(matrix<ET2, COT2> const& rhs)
+    {
+        if constexpr (detail::assignable_from<ET, ET2>)
+        {
+            m_matrix.engine() = rhs.engine();
+        }
+        else
+        {
+            detail::matrix_engine_support::assign_from(m_matrix.engine(), rhs.engine());
+        }
+        return m_matrix;
+    }
+
+    template<class ET2, class COT2>
+    constexpr matrix_type&
+    operator +=(matrix<ET2, COT2> const& rhs)
+    {
+        verify_same_size(rhs, "mis-matched operand sizes for +=");
+        detail::blas_operation_support::add_in_place(m_matrix, rhs);
+        return m_matrix;
+    }
+
+    template<class ET2, class COT2>
+    constexpr matrix_type&
+    operator -=(matrix<ET2, COT2> const& rhs)
+    {
+        verify_same_size(rhs, "mis-matched operand sizes for -=");
+        detail::blas_operation_support::subtract_in_place(m_matrix, rhs);
+        return m_matrix;
+    }
+
+    template<class ET2, class COT2>
+    constexpr matrix_type&
+    operator *=(matrix<ET2, COT2> const& rhs)
+    {
+        using support = detail::matrix_engine_support;
+
+        if (support::sizes_differ(m_matrix.columns(), rhs.rows(), rhs.rows(), rhs.columns()))
+        {
+            throw runtime_error("mis-matched operand sizes for *=");
+        }
+        detail::blas_operation_support::multiply_in_place(m_matrix, rhs);
+        return m_matrix;
+    }
+
+  private:
+    matrix_type&    m_matrix;
+
+    template<class ET2, class COT2>
+    constexpr void
+    verify_same_size(matrix<ET2, COT2> const& rhs, char const* msg) const
+    {
+        using support = detail::matrix_engine_support;
+
+        if (support::sizes_differ(m_matrix.rows(), m_matrix.columns(), rhs.rows(), rhs.columns()))
+        {
+            throw runtime_error(msg);
+        }
+    }
+};
+
 }       //- STD_LA namespace
 #endif  //- LINEAR_ALGEBRA_ARITHMETIC_OPERATORS_HPP_DEFINED
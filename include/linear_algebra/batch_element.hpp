@@ -0,0 +1,324 @@
+//==================================================================================================
+//  File:       batch_element.hpp
+//
+//  Summary:    This header defines a public element type that holds the corresponding elements of
+//              a batch of N matrices, so that arithmetic on one matrix of such elements operates
+//              on all N matrices at once, one per SIMD lane.
+//==================================================================================================
+//
+#ifndef LINEAR_ALGEBRA_BATCH_ELEMENT_HPP_DEFINED
+#define LINEAR_ALGEBRA_BATCH_ELEMENT_HPP_DEFINED
+
+namespace STD_LA {
+//--------------------------------------------------------------------------------------------------
+//  Class Template:     batch_element<T, N>
+//
+//  This public type holds N values of arithmetic type T, called lanes, and implements arithmetic
+//  on them lane by lane.  A matrix whose elements are of this type stores a batch of N matrices
+//  of the same extents in array-of-structures-of-arrays order: element (i, j) of all N matrices
+//  is contiguous, and element (i, j) of matrix p of the batch is m(i, j)[p].  Thus, for example,
+//
+//      fixed_size_matrix<batch_element<float, 8>, 3, 3>
+//
+//  holds eight 3x3 matrices, and its engine is an ordinary matrix_storage_engine.  Sums,
+//  products, inverse() and solve() applied to such matrices compute the results for all eight
+//  matrices at once, each step of the fixed-size kernels operating on one SIMD register of
+//  lanes instead of one element.  The lanes are aligned so that each element may be loaded into
+//  one register when N * sizeof(T) is 16 or 32 bytes; the register operations are those of
+//  simd_row_ops<T, N>, when it is available.
+//
+//  Two batch elements are equal if all of their lanes are equal, so that matrices of them may
+//  be compared by operator== as usual.
+//--------------------------------------------------------------------------------------------------
+//
+template<class T, size_t N>
+requires
+    (std::is_arithmetic_v<T> and not std::is_same_v<T, bool> and N > 0)
+class batch_element
+{
+    static constexpr size_t     lanes_size = N * sizeof(T);
+    static constexpr size_t     alignment  = (lanes_size % 32 == 0) ? 32 :
+                                             (lanes_size % 16 == 0) ? 16 : alignof(T);
+
+  public:
+    using value_type = T;
+
+  public:
+    ~batch_element() noexcept = default;
+
+    constexpr batch_element() noexcept = default;
+    constexpr batch_element(batch_element&&) noexcept = default;
+    constexpr batch_element(batch_element const&) noexcept = default;
+
+    constexpr batch_element(T const& t) noexcept
+    {
+        for (size_t i = 0;  i < N;  ++i)
+        {
+            m_lanes[i] = t;
+        }
+    }
+
+    constexpr batch_element&    operator =(batch_element&&) noexcept = default;
+    constexpr batch_element&    operator =(batch_element const&) noexcept = default;
+
+    static constexpr size_t
+    size() noexcept
+    {
+        return N;
+    }
+
+    constexpr T&
+    operator [](size_t lane) noexcept
+    {
+        return m_lanes[lane];
+    }
+
+    constexpr T const&
+    operator [](size_t lane) const noexcept
+    {
+        return m_lanes[lane];
+    }
+
+    //- Unary and compound assignment operators, applied lane by lane.
+    //
+    constexpr batch_element
+    operator -() const noexcept
+    {
+        batch_element   r;
+
+        for (size_t i = 0;  i < N;  ++i)
+        {
+            r.m_lanes[i] = -m_lanes[i];
+        }
+        return r;
+    }
+
+    constexpr batch_element
+    operator +() const noexcept
+    {
+        return *this;
+    }
+
+    constexpr batch_element&
+    operator +=(batch_element const& rhs) noexcept
+    {
+        return update(rhs, [](auto ops, auto x, auto y) { return ops.add(x, y); },
+                           [](T x, T y) { return x + y; });
+    }
+
+    constexpr batch_element&
+    operator -=(batch_element const& rhs) noexcept
+    {
+        return update(rhs, [](auto ops, auto x, auto y) { return ops.sub(x, y); },
+                           [](T x, T y) { return x - y; });
+    }
+
+    constexpr batch_element&
+    operator *=(batch_element const& rhs) noexcept
+    {
+        return update(rhs, [](auto ops, auto x, auto y) { return ops.mul(x, y); },
+                           [](T x, T y) { return x * y; });
+    }
+
+    constexpr batch_element&
+    operator /=(batch_element const& rhs) noexcept
+    {
+        return update(rhs, [](auto ops, auto x, auto y) { return ops.div(x, y); },
+                           [](T x, T y) { return x / y; });
+    }
+
+  private:
+    using row_ops = detail::simd_row_ops<T, N>;
+
+    alignas(alignment) T    m_lanes[N] = {};
+
+    //- Apply a binary operation to each pair of lanes, in one SIMD register if there is one
+    //  that holds exactly N lanes and the compiler has been told it may use.  The register
+    //  operations round each lane exactly as the scalar operations do.
+    //
+    template<class SOP, class OP>
+    constexpr batch_element&
+    update(batch_element const& rhs, SOP sop, OP op) noexcept
+    {
+        if constexpr (row_ops::available)
+        {
+            if (not std::is_constant_evaluated())
+            {
+                row_ops::store(m_lanes, sop(row_ops(), row_ops::load(m_lanes), row_ops::load(rhs.m_lanes)));
+                return *this;
+            }
+        }
+
+        for (size_t i = 0;  i < N;  ++i)
+        {
+            m_lanes[i] = op(m_lanes[i], rhs.m_lanes[i]);
+        }
+        return *this;
+    }
+};
+
+
+//--------------------------------------------------------------------------------------------------
+//  Binary operators for batch_element<T, N>.  Either operand may instead be a scalar convertible
+//  to T, which applies to every lane.
+//--------------------------------------------------------------------------------------------------
+//
+template<class T, size_t N>
+constexpr batch_element<T, N>
+operator +(batch_element<T, N> const& lhs, batch_element<T, N> const& rhs) noexcept
+{
+    batch_element<T, N>     r(lhs);
+
+    r += rhs;
+    return r;
+}
+
+template<class T, size_t N>
+constexpr batch_element<T, N>
+operator -(batch_element<T, N> const& lhs, batch_element<T, N> const& rhs) noexcept
+{
+    batch_element<T, N>     r(lhs);
+
+    r -= rhs;
+    return r;
+}
+
+template<class T, size_t N>
+constexpr batch_element<T, N>
+operator *(batch_element<T, N> const& lhs, batch_element<T, N> const& rhs) noexcept
+{
+    batch_element<T, N>     r(lhs);
+
+    r *= rhs;
+    return r;
+}
+
+template<class T, size_t N>
+constexpr batch_element<T, N>
+operator /(batch_element<T, N> const& lhs, batch_element<T, N> const& rhs) noexcept
+{
+    batch_element<T, N>     r(lhs);
+
+    r /= rhs;
+    return r;
+}
+
+//------
+//
+template<class T, size_t N, class S>
+requires
+    std::is_arithmetic_v<S>
+constexpr batch_element<T, N>
+operator +(batch_element<T, N> const& lhs, S const& rhs) noexcept
+{
+    batch_element<T, N>     r(lhs);
+
+    r += batch_element<T, N>(static_cast<T>(rhs));
+    return r;
+}
+
+template<class T, size_t N, class S>
+requires
+    std::is_arithmetic_v<S>
+constexpr batch_element<T, N>
+operator +(S const& lhs, batch_element<T, N> const& rhs) noexcept
+{
+    return batch_element<T, N>(static_cast<T>(lhs)) += rhs;
+}
+
+template<class T, size_t N, class S>
+requires
+    std::is_arithmetic_v<S>
+constexpr batch_element<T, N>
+operator -(batch_element<T, N> const& lhs, S const& rhs) noexcept
+{
+    batch_element<T, N>     r(lhs);
+
+    r -= batch_element<T, N>(static_cast<T>(rhs));
+    return r;
+}
+
+template<class T, size_t N, class S>
+requires
+    std::is_arithmetic_v<S>
+constexpr batch_element<T, N>
+operator -(S const& lhs, batch_element<T, N> const& rhs) noexcept
+{
+    return batch_element<T, N>(static_cast<T>(lhs)) -= rhs;
+}
+
+template<class T, size_t N, class S>
+requires
+    std::is_arithmetic_v<S>
+constexpr batch_element<T, N>
+operator *(batch_element<T, N> const& lhs, S const& rhs) noexcept
+{
+    batch_element<T, N>     r(lhs);
+
+    r *= batch_element<T, N>(static_cast<T>(rhs));
+    return r;
+}
+
+template<class T, size_t N, class S>
+requires
+    std::is_arithmetic_v<S>
+constexpr batch_element<T, N>
+operator *(S const& lhs, batch_element<T, N> const& rhs) noexcept
+{
+    return batch_element<T, N>(static_cast<T>(lhs)) *= rhs;
+}
+
+template<class T, size_t N, class S>
+requires
+    std::is_arithmetic_v<S>
+constexpr batch_element<T, N>
+operator /(batch_element<T, N> const& lhs, S const& rhs) noexcept
+{
+    batch_element<T, N>     r(lhs);
+
+    r /= batch_element<T, N>(static_cast<T>(rhs));
+    return r;
+}
+
+template<class T, size_t N, class S>
+requires
+    std::is_arithmetic_v<S>
+constexpr batch_element<T, N>
+operator /(S const& lhs, batch_element<T, N> const& rhs) noexcept
+{
+    return batch_element<T, N>(static_cast<T>(lhs)) /= rhs;
+}
+
+//------
+//
+template<class T, size_t N>
+constexpr bool
+operator ==(batch_element<T, N> const& lhs, batch_element<T, N> const& rhs) noexcept
+{
+    for (size_t i = 0;  i < N;  ++i)
+    {
+        if (lhs[i] != rhs[i]) return false;
+    }
+    return true;
+}
+
+template<class T, size_t N>
+constexpr bool
+operator !=(batch_element<T, N> const& lhs, batch_element<T, N> const& rhs) noexcept
+{
+    return !(lhs == rhs);
+}
+
+
+//--------------------------------------------------------------------------------------------------
+//  Variable Template:  default_batch_size_v<T>
+//
+//  The number of lanes of type T that fill a 256-bit SIMD register; e.g., 8 for float and 4
+//  for double.
+//--------------------------------------------------------------------------------------------------
+//
+template<class T> inline constexpr
+size_t  default_batch_size_v = (sizeof(T) < 32) ? 32 / sizeof(T) : 1;
+
+}       //- STD_LA namespace
+#endif  //- LINEAR_ALGEBRA_BATCH_ELEMENT_HPP_DEFINED
@@ -0,0 +1,1138 @@
+//==================================================================================================
+//  File:       blas_operations.hpp
+//
+//  Summary:    This header defines public functions that perform BLAS-style updates of an
+//              existing matrix in place, writing their results into storage owned by the caller
+//              rather than into a newly-constructed matrix.
+//==================================================================================================
+//
+#ifndef LINEAR_ALGEBRA_BLAS_OPERATIONS_HPP_DEFINED
+#define LINEAR_ALGEBRA_BLAS_OPERATIONS_HPP_DEFINED
+
+namespace STD_LA {
+namespace detail {
+//--------------------------------------------------------------------------------------------------
+//  Trait:      is_matrix<T>
+//  Concept:    matrix_batch<BT>
+//  Concept:    writable_matrix_batch<BT>
+//  Concept:    dense_batch_mdspan<MS>
+//  Trait:      scalar_arithmetic_type<T, S>
+//  Concept:    exact_scalar_for<S, T>
+//
+//  The first trait determines whether a type is a specialization of matrix<ET, COT>.  The first
+//  two concepts determine whether a type is a batch of matrices to be used by gemm_batched();
+//  i.e., whether it provides size() and operator[], as do std::vector and std::span, and whether
+//  its matrices may be written.  The third concept determines whether an mdspan type addresses
+//  a batch of dense matrices, indexed by (batch, row, column).  The last trait and concept
+//  determine the type in which an element of type T is multiplied or divided by a scalar S, and
+//  whether S may be converted to T beforehand without changing the result.
+//--------------------------------------------------------------------------------------------------
+//
+template<class T>
+struct is_matrix : public false_type
+{};
+
+template<class ET, class COT>
+struct is_matrix<matrix<ET, COT>> : public true_type
+{};
+
+template<class BT>
+using batch_matrix_t = std::remove_cvref_t<decltype(std::declval<BT&>()[size_t{}])>;
+
+//------
+//
+template<class BT>
+concept matrix_batch =
+    requires (BT const& b, size_t p)
+    {
+        static_cast<size_t>(b.size());
+        b[p];
+    }
+    and
+    is_matrix<batch_matrix_t<BT const>>::value;
+
+template<class BT>
+concept writable_matrix_batch =
+    matrix_batch<BT>
+    and
+    writable_matrix_engine<typename batch_matrix_t<BT>::engine_type>
+    and
+    requires (BT& b, size_t p)
+    {
+        { b[p] } -> same_as<batch_matrix_t<BT>&>;
+    };
+
+template<class MS>
+concept dense_batch_mdspan =
+    (MS::rank() == 3)
+    and
+    MS::mapping_type::is_always_strided()
+    and
+    same_as<typename MS::accessor_type,
+            MDSPAN_NS::default_accessor<typename MS::element_type>>
+    and
+    gemm_element<std::remove_const_t<typename MS::element_type>>;
+
+//- A scalar S multiplies or divides elements of type T exactly as a value of type T when their
+//  common type is T itself, so that converting it once to T beforehand changes no result.
+//  Scalars having no common type with T, such as int with complex<double>, must be converted.
+//
+template<class T, class S>
+struct scalar_arithmetic_type
+{
+    using type = T;
+};
+
+template<class T, class S>
+requires
+    requires { typename common_type_t<T, S>; }
+struct scalar_arithmetic_type<T, S>
+{
+    using type = common_type_t<T, S>;
+};
+
+template<class S, class T>
+concept exact_scalar_for = same_as<typename scalar_arithmetic_type<T, S>::type, T>;
+
+
+//--------------------------------------------------------------------------------------------------
+//  Class:      blas_operation_support
+//
+//  This private type provides the checks and loop nests shared by the public in-place
+//  functions defined below.
+//--------------------------------------------------------------------------------------------------
+//
+struct blas_operation_support
+{
+    //- Ensure that the result matrix C has the given extents.  If its contents are not needed
+    //  and its engine permits, C is resized; resizing a matrix_storage_engine only allocates
+    //  when its capacity is insufficient.  Otherwise, mis-matched extents are an error.
+    //
+    template<class ET, class COT>
+    static constexpr void
+    prepare_result(matrix<ET, COT>& c, size_t rows, size_t cols, bool preserve)
+    {
+        using size_type = typename matrix<ET, COT>::size_type;
+
+        if (not matrix_engine_support::sizes_differ(c.rows(), c.columns(), rows, cols))
+        {
+            return;
+        }
+
+        if (not preserve)
+        {
+            if constexpr (reshapable_matrix_engine<ET>)
+            {
+                c.resize(static_cast<size_type>(rows), static_cast<size_type>(cols));
+                return;
+            }
+            else if constexpr (row_reshapable_matrix_engine<ET>)
+            {
+                if (not matrix_engine_support::sizes_differ(c.columns(), cols))
+                {
+                    c.resize_rows(static_cast<size_type>(rows));
+                    return;
+                }
+            }
+            else if constexpr (column_reshapable_matrix_engine<ET>)
+            {
+                if (not matrix_engine_support::sizes_differ(c.rows(), rows))
+                {
+                    c.resize_columns(static_cast<size_type>(cols));
+                    return;
+                }
+            }
+        }
+
+        throw runtime_error("invalid size of result matrix");
+    }
+
+    //- Compute C = alpha*A*B + beta*C with a simple loop nest.  As in the reference BLAS, each
+    //  row (or column) of C is first scaled by beta, and then updated by the scaled rows of B
+    //  (or columns of A), so that C is always traversed contiguously.  If beta is zero, C is
+    //  not read.
+    //
+    template<class T, class MT1, class MT2, class MTR>
+    static constexpr void
+    gemm(T const& alpha, MT1 const& a, MT2 const& b, T const& beta, MTR& c)
+    {
+        using size_type_1 = typename MT1::size_type;
+        using size_type_2 = typename MT2::size_type;
+        using size_type_r = typename MTR::size_type;
+        using layout_type = get_layout_t<typename MTR::engine_type>;
+
+        size_type_r const   rows  = c.rows();
+        size_type_r const   cols  = c.columns();
+        size_type_1 const   inner = a.columns();
+
+        if constexpr (same_as<layout_type, matrix_layout::column_major>)
+        {
+            size_type_r     jr = 0;
+            size_type_2     j2 = 0;
+
+            for (;  jr < cols;  ++jr, ++j2)
+            {
+                for (size_type_r ir = 0;  ir < rows;  ++ir)
+                {
+                    c(ir, jr) = (beta == T{}) ? T{} : beta * c(ir, jr);
+                }
+
+                size_type_1     k1 = 0;
+                size_type_2     k2 = 0;
+
+                for (;  k1 < inner;  ++k1, ++k2)
+                {
+                    T const         t  = alpha * b(k2, j2);
+                    size_type_r     ir = 0;
+                    size_type_1     i1 = 0;
+
+                    for (;  ir < rows;  ++ir, ++i1)
+                    {
+                        c(ir, jr) = c(ir, jr) + a(i1, k1) * t;
+                    }
+                }
+            }
+        }
+        else
+        {
+            size_type_r     ir = 0;
+            size_type_1     i1 = 0;
+
+            for (;  ir < rows;  ++ir, ++i1)
+            {
+                for (size_type_r jr = 0;  jr < cols;  ++jr)
+                {
+                    c(ir, jr) = (beta == T{}) ? T{} : beta * c(ir, jr);
+                }
+
+                size_type_1     k1 = 0;
+                size_type_2     k2 = 0;
+
+                for (;  k1 < inner;  ++k1, ++k2)
+                {
+                    T const         t  = alpha * a(i1, k1);
+                    size_type_r     jr = 0;
+                    size_type_2     j2 = 0;
+
+                    for (;  jr < cols;  ++jr, ++j2)
+                    {
+                        c(ir, jr) = c(ir, jr) + t * b(k2, j2);
+                    }
+                }
+            }
+        }
+    }
+
+    //- Compute Y(i, j) = op(Y(i, j), X(i, j)) for every element of Y, traversing Y in the order
+    //  of its layout.  X and Y must have the same extents.
+    //
+    template<class MTR, class MT1, class OP>
+    static constexpr void
+    update(MTR& y, MT1 const& x, OP op)
+    {
+        using size_type_1 = typename MT1::size_type;
+        using size_type_r = typename MTR::size_type;
+        using layout_type = get_layout_t<typename MTR::engine_type>;
+
+        if constexpr (same_as<layout_type, matrix_layout::column_major>)
+        {
+            size_type_r     jr = 0;
+            size_type_1     j1 = 0;
+
+            for (;  jr < y.columns();  ++jr, ++j1)
+            {
+                size_type_r     ir = 0;
+                size_type_1     i1 = 0;
+
+                for (;  ir < y.rows();  ++ir, ++i1)
+                {
+                    y(ir, jr) = op(y(ir, jr), x(i1, j1));
+                }
+            }
+        }
+        else
+        {
+            size_type_r     ir = 0;
+            size_type_1     i1 = 0;
+
+            for (;  ir < y.rows();  ++ir, ++i1)
+            {
+                size_type_r     jr = 0;
+                size_type_1     j1 = 0;
+
+                for (;  jr < y.columns();  ++jr, ++j1)
+                {
+                    y(ir, jr) = op(y(ir, jr), x(i1, j1));
+                }
+            }
+        }
+    }
+
+    //- Compute Y(i, j) = op(Y(i, j)) for every element of Y, traversing Y in the order of its
+    //  layout.
+    //
+    template<class MTR, class OP>
+    static constexpr void
+    update(MTR& y, OP op)
+    {
+        using size_type   = typename MTR::size_type;
+        using layout_type = get_layout_t<typename MTR::engine_type>;
+
+        if constexpr (same_as<layout_type, matrix_layout::column_major>)
+        {
+            for (size_type j = 0;  j < y.columns();  ++j)
+            {
+                for (size_type i = 0;  i < y.rows();  ++i)
+                {
+                    y(i, j) = op(y(i, j));
+                }
+            }
+        }
+        else
+        {
+            for (size_type i = 0;  i < y.rows();  ++i)
+            {
+                for (size_type j = 0;  j < y.columns();  ++j)
+                {
+                    y(i, j) = op(y(i, j));
+                }
+            }
+        }
+    }
+
+    //- Compute A = A*B, where B is square, in place.  Each row of the product depends only on
+    //  the corresponding row of A, so a copy of that one row is the only workspace required.
+    //  The workspace is a std::array when the number of columns of A is known at compile time,
+    //  and a std::vector otherwise.  B must not overlap A.
+    //
+    template<class T, size_t N>
+    struct row_workspace
+    {
+        using type = array<T, N>;
+
+        static constexpr type
+        make(size_t) noexcept
+        {
+            return type{};
+        }
+    };
+
+    template<class T>
+    struct row_workspace<T, std::dynamic_extent>
+    {
+        using type = vector<T>;
+
+        static constexpr type
+        make(size_t n)
+        {
+            return type(n);
+        }
+    };
+
+    template<class MT1, class MT2>
+    static constexpr void
+    multiply_in_place(MT1& a, MT2 const& b)
+    {
+        using engine_type_1 = typename MT1::engine_type;
+        using engine_type_2 = typename MT2::engine_type;
+        using element_type  = typename MT1::element_type;
+        using size_type_1   = typename MT1::size_type;
+        using size_type_2   = typename MT2::size_type;
+        using workspace     = row_workspace<element_type,
+                                            engine_extents_helper<engine_type_1>::columns()>;
+
+        size_t const    rows = static_cast<size_t>(a.rows());
+        size_t const    n    = static_cast<size_t>(a.columns());
+        auto            w    = workspace::make(n);
+
+        //- For dense operands, each row of the product is computed as B^T*w by the GEMV kernel.
+        //
+        if constexpr (gemm_engines<engine_type_1, engine_type_1, engine_type_2>)
+        {
+            if (not std::is_constant_evaluated())
+            {
+                using kernel_type = gemv_kernel<element_type>;
+
+                auto const  da = make_dense_operand(a.span());
+                auto const  bt = make_dense_operand(b.span()).transposed();
+
+                for (size_t i = 0;  i < rows;  ++i)
+                {
+                    for (size_t k = 0;  k < n;  ++k)
+                    {
+                        w[k] = da(i, k);
+                    }
+                    kernel_type::multiply(bt, w.data(), 1, &da(i, 0), da.col_stride);
+                }
+                return;
+            }
+        }
+
+        for (size_type_1 i = 0;  i < static_cast<size_type_1>(rows);  ++i)
+        {
+            size_type_1     j1 = 0;
+
+            for (size_t k = 0;  k < n;  ++k, ++j1)
+            {
+                w[k] = a(i, j1);
+                a(i, j1) = element_type{};
+            }
+
+            size_type_2     k2 = 0;
+
+            for (size_t k = 0;  k < n;  ++k, ++k2)
+            {
+                element_type const  t  = w[k];
+                size_type_2         j2 = 0;
+
+                for (j1 = 0;  j1 < static_cast<size_type_1>(n);  ++j1, ++j2)
+                {
+                    a(i, j1) = a(i, j1) + t * b(k2, j2);
+                }
+            }
+        }
+    }
+
+    //- Compute C = alpha*A*B + beta*C, where C already has the extents of the product.  The
+    //  packed kernel is used when all three engines expose their elements directly and the
+    //  product is large enough to amortize the cost of packing; matrix-vector products are
+    //  already traversed in a single pass by the loop nest.  The operands may also be
+    //  negation, conjugate, or hermitian views, which the packed kernel unwraps into flags;
+    //  if beta is zero and B is the transpose of A, only one triangle of C is computed.
+    //
+    template<class T, class MT1, class MT2, class MTR>
+    static constexpr void
+    multiply_add(T const& alpha, MT1 const& a, MT2 const& b, T const& beta, MTR& c)
+    {
+        using engine_type_1 = typename MT1::engine_type;
+        using engine_type_2 = typename MT2::engine_type;
+        using engine_type_r = typename MTR::engine_type;
+
+        if constexpr (view_gemm_engines<engine_type_r, engine_type_1, engine_type_2>)
+        {
+            using kernel_type = gemm_kernel<T>;
+
+            size_t const    rows  = static_cast<size_t>(c.rows());
+            size_t const    cols  = static_cast<size_t>(c.columns());
+            size_t const    inner = static_cast<size_t>(a.columns());
+
+            if (not std::is_constant_evaluated()  &&  rows > 1  &&  cols > 1  &&
+                rows * cols * inner >= kernel_type::blocking_traits::min_work)
+            {
+                kernel_type::multiply(alpha, make_view_operand(a.span()),
+                                      make_view_operand(b.span()),
+                                      beta, make_dense_operand(c.span()));
+                return;
+            }
+        }
+
+        gemm(alpha, a, b, beta, c);
+    }
+
+    //- Compute C = alpha*A*A^T + beta*C, or C = alpha*A*A^H + beta*C if HERM is set, where C
+    //  already has the extents of the product and is taken to be symmetric (or Hermitian).
+    //  Only the lower triangle is computed, and then copied to the upper; if beta is non-zero,
+    //  the result depends only on the lower triangle of C, although the packed kernel may also
+    //  read the upper.  Dense operands, and views of them, use the packed kernel's symmetric
+    //  product; otherwise each element of the lower triangle is computed as a dot product.
+    //
+    template<bool HERM, class T, class MT1, class MTR>
+    static constexpr void
+    rank_k_update(T const& alpha, MT1 const& a, T const& beta, MTR& c)
+    {
+        using engine_type_1 = typename MT1::engine_type;
+        using engine_type_r = typename MTR::engine_type;
+        using size_type_1   = typename MT1::size_type;
+        using size_type_r   = typename MTR::size_type;
+
+        auto const  conj_if = [](T const& t, bool conj)
+        {
+            if constexpr (is_complex_v<T>)
+            {
+                return (conj) ? std::conj(t) : t;
+            }
+            else
+            {
+                return t;
+            }
+        };
+
+        size_t const    n = static_cast<size_t>(a.rows());
+        size_t const    k = static_cast<size_t>(a.columns());
+
+        if constexpr (view_gemm_engines<engine_type_r, engine_type_1, engine_type_1>)
+        {
+            using kernel_type = gemm_kernel<T>;
+
+            if (not std::is_constant_evaluated()  &&  n * n * k >= kernel_type::blocking_traits::min_work)
+            {
+                auto const  va = make_view_operand(a.span());
+
+                kernel_type::symmetric_multiply(alpha, va.op, beta, make_dense_operand(c.span()),
+                                                kernel_type::select_micro_kernel(),
+                                                va.conj, va.conj != HERM);
+                return;
+            }
+        }
+
+        for (size_type_r i = 0;  i < static_cast<size_type_r>(n);  ++i)
+        {
+            for (size_type_r j = 0;  j <= i;  ++j)
+            {
+                size_type_1 const   i1 = static_cast<size_type_1>(i);
+                size_type_1 const   j1 = static_cast<size_type_1>(j);
+                T                   e{};
+
+                for (size_type_1 p = 0;  p < static_cast<size_type_1>(k);  ++p)
+                {
+                    e = e + a(i1, p) * conj_if(a(j1, p), HERM);
+                }
+                c(i, j) = (beta == T{}) ? alpha * e : alpha * e + beta * c(i, j);
+            }
+        }
+        for (size_type_r i = 0;  i < static_cast<size_type_r>(n);  ++i)
+        {
+            if constexpr (HERM  and  is_complex_v<T>)
+            {
+                c(i, i) = T(c(i, i).real());
+            }
+            for (size_type_r j = 0;  j < i;  ++j)
+            {
+                c(j, i) = conj_if(c(i, j), HERM);
+            }
+        }
+    }
+
+    //- Compute the rank-k update as above into C, which is prepared as by gemm(); if C overlaps
+    //  A, the update is computed in a temporary and then assigned to C.
+    //
+    template<bool HERM, class S1, class ET1, class COT1, class S2, class ETR, class COTR>
+    static constexpr void
+    rank_k_update_into(S1 const& alpha, matrix<ET1, COT1> const& a, S2 const& beta,
+                       matrix<ETR, COTR>& c)
+    {
+        using element_type = typename ETR::element_type;
+
+        element_type const  al = static_cast<element_type>(alpha);
+        element_type const  be = static_cast<element_type>(beta);
+        size_t const        n  = static_cast<size_t>(a.rows());
+
+        if (matrix_engine_support::overlap(c.engine(), a.engine()))
+        {
+            matrix<temporary_engine_t<ETR>, COTR>   tmp;
+
+            if (be != element_type{})
+            {
+                matrix_engine_support::assign_from(tmp.engine(), c.engine());
+            }
+            prepare_result(tmp, n, n, be != element_type{});
+            rank_k_update<HERM>(al, a, be, tmp);
+            prepare_result(c, n, n, be != element_type{});
+            matrix_engine_support::assign_from(c.engine(), tmp.engine());
+        }
+        else
+        {
+            prepare_result(c, n, n, be != element_type{});
+            rank_k_update<HERM>(al, a, be, c);
+        }
+    }
+
+    //- Compute C = alpha*A*B + beta*C as above, but accumulating each element of the product
+    //  in the wider type AT.  The dense kernel converts the operands to AT as it packs them;
+    //  the loop nest computes each element as a dot product.
+    //
+    template<class AT, class T, class MT1, class MT2, class MTR>
+    static constexpr void
+    multiply_add_wide(T const& alpha, MT1 const& a, MT2 const& b, T const& beta, MTR& c)
+    {
+        using engine_type_1 = typename MT1::engine_type;
+        using engine_type_2 = typename MT2::engine_type;
+        using engine_type_r = typename MTR::engine_type;
+        using size_type_1   = typename MT1::size_type;
+        using size_type_2   = typename MT2::size_type;
+        using size_type_r   = typename MTR::size_type;
+
+        if constexpr (gemm_engines<engine_type_r, engine_type_1, engine_type_2>  and
+                      gemm_element<AT>)
+        {
+            using kernel_type = mixed_gemm_kernel<T, AT>;
+
+            size_t const    rows  = static_cast<size_t>(c.rows());
+            size_t const    cols  = static_cast<size_t>(c.columns());
+            size_t const    inner = static_cast<size_t>(a.columns());
+
+            if (not std::is_constant_evaluated()  &&
+                rows * cols * inner >= kernel_type::blocking_traits::min_work)
+            {
+                kernel_type::multiply(alpha, make_dense_operand(a.span()),
+                                      make_dense_operand(b.span()),
+                                      beta, make_dense_operand(c.span()));
+                return;
+            }
+        }
+
+        AT const    al = static_cast<AT>(alpha);
+        AT const    be = static_cast<AT>(beta);
+
+        size_type_r     ir = 0;
+        size_type_1     i1 = 0;
+
+        for (;  ir < c.rows();  ++ir, ++i1)
+        {
+            size_type_r     jr = 0;
+            size_type_2     j2 = 0;
+
+            for (;  jr < c.columns();  ++jr, ++j2)
+            {
+                AT              er{};
+                size_type_1     k1 = 0;
+                size_type_2     k2 = 0;
+
+                for (;  k1 < a.columns();  ++k1, ++k2)
+                {
+                    er = er + accumulator_product<AT, T>(a(i1, k1), b(k2, j2));
+                }
+
+                er = al * er;
+                c(ir, jr) = static_cast<T>((beta == T{}) ? er : er + be * static_cast<AT>(c(ir, jr)));
+            }
+        }
+    }
+
+    //- Compute C = alpha*A*B + beta*C for one product of a batch, where C already has the
+    //  extents of the product and does not overlap A or B.  The product is accumulated in the
+    //  accumulator type named by C's operation traits.  Products having small, fixed extents
+    //  are unrolled when they are simple products; dense operands are multiplied by the
+    //  batched kernel, which computes small products without packing them.
+    //
+    template<class T, class MT1, class MT2, class ETR, class COTR>
+    static constexpr void
+    multiply_batched(T const& alpha, MT1 const& a, MT2 const& b, T const& beta,
+                     matrix<ETR, COTR>& c)
+    {
+        using engine_type_1    = typename MT1::engine_type;
+        using engine_type_2    = typename MT2::engine_type;
+        using engine_type_r    = ETR;
+        using element_traits   = multiplication_element_traits_t<COTR, typename MT1::element_type,
+                                                                 typename MT2::element_type>;
+        using accumulator_type = multiplication_accumulator_t<element_traits>;
+
+        constexpr size_t    inner_extent = engine_extents_helper<engine_type_1>::columns();
+
+        if constexpr (not same_as<accumulator_type, T>)
+        {
+            multiply_add_wide<accumulator_type>(alpha, a, b, beta, c);
+            return;
+        }
+        else if constexpr (small_fixed_size_engine<engine_type_r>  and
+                           small_fixed_size_engine<engine_type_1>  and
+                           small_fixed_size_engine<engine_type_2>)
+        {
+            if (alpha == T{1}  &&  beta == T{})
+            {
+                fixed_size_kernel_for<engine_type_r>::template multiply<inner_extent, T>(c, a, b);
+                return;
+            }
+        }
+        else if constexpr (gemm_engines<engine_type_r, engine_type_1, engine_type_2>)
+        {
+            if (not std::is_constant_evaluated())
+            {
+                batched_gemm_kernel<T>::multiply(alpha, make_dense_operand(a.span()),
+                                                 make_dense_operand(b.span()),
+                                                 beta, make_dense_operand(c.span()));
+                return;
+            }
+        }
+
+        multiply_add(alpha, a, b, beta, c);
+    }
+
+    //- Compute Y = alpha*X + Y, where X and Y have the same extents and do not alias.  X may be
+    //  a transpose or negation view, whose negation is folded into alpha.
+    //
+    template<class T, class MT1, class MTR>
+    static constexpr void
+    axpy(T const& alpha, MT1 const& x, MTR& y)
+    {
+        using engine_type_1 = typename MT1::engine_type;
+        using engine_type_r = typename MTR::engine_type;
+
+        if constexpr (view_addition_engines<engine_type_r, engine_type_1, engine_type_r>)
+        {
+            if (not std::is_constant_evaluated())
+            {
+                auto const  vx = make_view_operand(x.span());
+
+                gemv_kernel<T>::axpy((vx.negate) ? T(-alpha) : alpha, vx.op,
+                                     make_dense_operand(y.span()));
+                return;
+            }
+        }
+
+        update(y, x, [&alpha](auto const& t1, auto const& t2) { return t1 + alpha * t2; });
+    }
+
+    //- Compute Y = Y + X and Y = Y - X, where X and Y have the same extents and do not alias.
+    //  Dense operands having the same element type, and transpose and negation views of them,
+    //  are updated by the AXPY kernel, which is exact for a coefficient of 1 or -1.
+    //
+    template<class MT1, class MTR>
+    static constexpr void
+    add_in_place(MTR& y, MT1 const& x)
+    {
+        using element_type = typename MTR::element_type;
+
+        if constexpr (view_addition_engines<typename MTR::engine_type, typename MT1::engine_type,
+                                            typename MTR::engine_type>)
+        {
+            axpy(element_type(1), x, y);
+        }
+        else
+        {
+            update(y, x, [](auto const& t1, auto const& t2) { return t1 + t2; });
+        }
+    }
+
+    template<class MT1, class MTR>
+    static constexpr void
+    subtract_in_place(MTR& y, MT1 const& x)
+    {
+        using element_type = typename MTR::element_type;
+
+        if constexpr (view_addition_engines<typename MTR::engine_type, typename MT1::engine_type,
+                                            typename MTR::engine_type>)
+        {
+            axpy(element_type(-1), x, y);
+        }
+        else
+        {
+            update(y, x, [](auto const& t1, auto const& t2) { return t1 - t2; });
+        }
+    }
+
+    //- Compute X = alpha*X and X = X/alpha in place, with each element computed as it would
+    //  be by X*alpha or X/alpha and then converted once to the element type.  Only a scalar
+    //  that converts to the element type without changing any result is converted beforehand,
+    //  so that dense operands may be updated by the kernels.
+    //
+    template<class S, class MTR>
+    static constexpr void
+    scale_in_place(S const& alpha, MTR& x)
+    {
+        using element_type = typename MTR::element_type;
+        using engine_type  = typename MTR::engine_type;
+
+        if constexpr (exact_scalar_for<S, element_type>)
+        {
+            element_type const  al = static_cast<element_type>(alpha);
+
+            if constexpr (gemm_engines<engine_type, engine_type, engine_type>)
+            {
+                if (not std::is_constant_evaluated())
+                {
+                    gemv_kernel<element_type>::scale(al, make_dense_operand(x.span()));
+                    return;
+                }
+            }
+            update(x, [&al](element_type const& t) { return al * t; });
+        }
+        else
+        {
+            update(x, [&alpha](element_type const& t)
+                      { return static_cast<element_type>(alpha * t); });
+        }
+    }
+
+    template<class S, class MTR>
+    static constexpr void
+    divide_in_place(MTR& x, S const& alpha)
+    {
+        using element_type = typename MTR::element_type;
+        using engine_type  = typename MTR::engine_type;
+
+        if constexpr (exact_scalar_for<S, element_type>)
+        {
+            element_type const  al = static_cast<element_type>(alpha);
+
+            if constexpr (gemm_engines<engine_type, engine_type, engine_type>)
+            {
+                if (not std::is_constant_evaluated())
+                {
+                    gemv_kernel<element_type>::divide(make_dense_operand(x.span()), al);
+                    return;
+                }
+            }
+            update(x, [&al](element_type const& t) { return t / al; });
+        }
+        else
+        {
+            update(x, [&alpha](element_type const& t)
+                      { return static_cast<element_type>(t / alpha); });
+        }
+    }
+};
+
+}       //- detail namespace
+
+
+//--------------------------------------------------------------------------------------------------
+//  Function:   gemm(alpha, A, B, beta, C)
+//
+//  Computes C = alpha*A*B + beta*C, writing the result into the existing matrix C.  If beta is
+//  zero, the prior contents of C are not read, and C is resized to fit the product if its
+//  extents differ and its engine permits; since resizing retains capacity, a C that is reused
+//  for products of the same size is only allocated once.  If C overlaps A or B, the result is
+//  computed in a temporary and then assigned to C.  The elements of A*B are accumulated in the
+//  accumulator type named by the multiplication element traits of C's operation traits.
+//--------------------------------------------------------------------------------------------------
+//
+template<class S1, class ET1, class COT1, class ET2, class COT2, class S2, class ETR, class COTR>
+requires
+    detail::writable_matrix_engine<ETR>
+constexpr void
+gemm(S1 const& alpha, matrix<ET1, COT1> const& a, matrix<ET2, COT2> const& b,
+     S2 const& beta, matrix<ETR, COTR>& c)
+{
+    using element_type     = typename ETR::element_type;
+    using element_traits   = detail::multiplication_element_traits_t<COTR, typename ET1::element_type,
+                                                                     typename ET2::element_type>;
+    using accumulator_type = detail::multiplication_accumulator_t<element_traits>;
+    using support          = detail::blas_operation_support;
+    using engine_support   = detail::matrix_engine_support;
+
+    element_type const  al = static_cast<element_type>(alpha);
+    element_type const  be = static_cast<element_type>(beta);
+
+    size_t const    rows = static_cast<size_t>(a.rows());
+    size_t const    cols = static_cast<size_t>(b.columns());
+
+    auto    multiply_add = [&](auto& r)
+    {
+        if constexpr (same_as<accumulator_type, element_type>)
+        {
+            support::multiply_add(al, a, b, be, r);
+        }
+        else
+        {
+            support::template multiply_add_wide<accumulator_type>(al, a, b, be, r);
+        }
+    };
+
+    if (engine_support::sizes_differ(a.columns(), b.rows()))
+    {
+        throw runtime_error("mis-matched operand sizes for gemm");
+    }
+
+    if (engine_support::overlap(c.engine(), a.engine())  ||
+        engine_support::overlap(c.engine(), b.engine()))
+    {
+        matrix<detail::temporary_engine_t<ETR>, COTR>   tmp;
+
+        if (be != element_type{})
+        {
+            engine_support::assign_from(tmp.engine(), c.engine());
+        }
+        support::prepare_result(tmp, rows, cols, be != element_type{});
+        multiply_add(tmp);
+        support::prepare_result(c, rows, cols, be != element_type{});
+        engine_support::assign_from(c.engine(), tmp.engine());
+    }
+    else
+    {
+        support::prepare_result(c, rows, cols, be != element_type{});
+        multiply_add(c);
+    }
+}
+
+
+//--------------------------------------------------------------------------------------------------
+//  Functions:  syrk(alpha, A, beta, C)
+//              herk(alpha, A, beta, C)
+//
+//  Compute the symmetric rank-k update C = alpha*A*A^T + beta*C and the Hermitian rank-k update
+//  C = alpha*A*A^H + beta*C, respectively, writing the result into the existing matrix C, whose
+//  rows and columns are as many as the rows of A.  C is prepared as by gemm().  Only the lower
+//  triangle of the result is computed, at about half the cost of the full product, and it is
+//  then copied to the upper triangle; if beta is non-zero, C is taken to be symmetric (or
+//  Hermitian), and the result depends only on its lower triangle.  For herk(), alpha and beta
+//  should be real, and the diagonal of the result is made real.  A^T*A and A^H*A are computed
+//  by passing A.t() and A.h() as A.  Products such as A*A.t() and A.h()*A are also recognized
+//  by the multiplication operator and gemm(), when beta is zero.
+//--------------------------------------------------------------------------------------------------
+//
+template<class S1, class ET1, class COT1, class S2, class ETR, class COTR>
+requires
+    detail::writable_matrix_engine<ETR>
+constexpr void
+syrk(S1 const& alpha, matrix<ET1, COT1> const& a, S2 const& beta, matrix<ETR, COTR>& c)
+{
+    detail::blas_operation_support::template rank_k_update_into<false>(alpha, a, beta, c);
+}
+
+template<class S1, class ET1, class COT1, class S2, class ETR, class COTR>
+requires
+    detail::writable_matrix_engine<ETR>
+constexpr void
+herk(S1 const& alpha, matrix<ET1, COT1> const& a, S2 const& beta, matrix<ETR, COTR>& c)
+{
+    detail::blas_operation_support::template rank_k_update_into<true>(alpha, a, beta, c);
+}
+
+
+//--------------------------------------------------------------------------------------------------
+//  Functions:  spgemm(pattern, A, B)
+//              spgemm_values(pattern, A, B, C)
+//
+//  For the sparse matrices A and B, spgemm() returns the product A*B, as computed by the
+//  multiplication operator, and records its symbolic phase in pattern.  spgemm_values() then
+//  recomputes only the values of such a product C, in place, from operands having the same
+//  sparsity patterns as those of the recorded product, as when a product such as R*A*P is
+//  formed again after the values of A change; the elements of C are the same as spgemm() would
+//  compute.  It throws if the extents, forms or numbers of elements of the operands or of C
+//  differ from those recorded, or if any product term falls outside the pattern of C.
+//--------------------------------------------------------------------------------------------------
+//
+template<class ET1, class COT1, class ET2, class COT2>
+requires
+    detail::compressed_matrix_engine<ET1> and detail::compressed_matrix_engine<ET2>
+auto
+spgemm(sparse_product_pattern& pattern, matrix<ET1, COT1> const& a, matrix<ET2, COT2> const& b)
+{
+    using op_traits  = select_matrix_operation_traits_t<COT1, COT2>;
+    using mul_traits = detail::multiplication_arithmetic_traits<op_traits, matrix<ET1, COT1>,
+                                                                matrix<ET2, COT2>>;
+
+    return mul_traits::multiply(pattern, a, b);
+}
+
+template<class ET1, class COT1, class ET2, class COT2, class ETR, class COTR>
+requires
+    detail::compressed_matrix_engine<ET1> and detail::compressed_matrix_engine<ET2>
+void
+spgemm_values(sparse_product_pattern const& pattern, matrix<ET1, COT1> const& a,
+              matrix<ET2, COT2> const& b, matrix<ETR, COTR>& c)
+{
+    using op_traits  = select_matrix_operation_traits_t<COT1, COT2>;
+    using mul_traits = detail::multiplication_arithmetic_traits<op_traits, matrix<ET1, COT1>,
+                                                                matrix<ET2, COT2>>;
+
+    static_assert(same_as<matrix<ETR, COTR>, typename mul_traits::result_type>,
+                  "the result of spgemm_values() must have the type of the product");
+
+    mul_traits::multiply_values(pattern, a, b, c);
+}
+
+
+//--------------------------------------------------------------------------------------------------
+//  Function:   gemm_batched(alpha, As, Bs, beta, Cs)
+//
+//  Computes C[p] = alpha*A[p]*B[p] + beta*C[p] for each p in [0, N), where As, Bs and Cs are
+//  batches of N matrices, such as std::vector or std::span, writing each result into the
+//  existing matrix C[p].  Every A[p] must have the same extents, as must every B[p].  Each C[p]
+//  is prepared as by gemm(), and so is only allocated if it cannot hold the product; a batch of
+//  results that is reused for batches of the same size is only allocated once.
+//
+//  The operation traits are resolved once for the whole batch, and the products are computed
+//  in parallel across the batch by up to `max_threads` threads, where zero means the number of
+//  hardware threads.  Products having small, fixed extents are unrolled; small dense products
+//  are computed without packing.
+//--------------------------------------------------------------------------------------------------
+//
+template<class S1, class BT1, class BT2, class S2, class BTR>
+requires
+    detail::matrix_batch<BT1>
+    and
+    detail::matrix_batch<BT2>
+    and
+    detail::writable_matrix_batch<std::remove_reference_t<BTR>>
+void
+gemm_batched(S1 const& alpha, BT1 const& as, BT2 const& bs, S2 const& beta, BTR&& cs,
+             size_t max_threads = 0)
+{
+    using matrix_type_1  = detail::batch_matrix_t<BT1 const>;
+    using matrix_type_2  = detail::batch_matrix_t<BT2 const>;
+    using matrix_type_r  = detail::batch_matrix_t<std::remove_reference_t<BTR>>;
+    using element_type   = typename matrix_type_r::element_type;
+    using support        = detail::blas_operation_support;
+    using engine_support = detail::matrix_engine_support;
+
+    element_type const  al = static_cast<element_type>(alpha);
+    element_type const  be = static_cast<element_type>(beta);
+
+    size_t const    count = static_cast<size_t>(as.size());
+
+    if (static_cast<size_t>(bs.size()) != count  ||  static_cast<size_t>(cs.size()) != count)
+    {
+        throw runtime_error("mis-matched batch sizes for gemm_batched");
+    }
+    if (count == 0)
+    {
+        return;
+    }
+
+    size_t const    rows  = static_cast<size_t>(as[0].rows());
+    size_t const    inner = static_cast<size_t>(as[0].columns());
+    size_t const    cols  = static_cast<size_t>(bs[0].columns());
+
+    //- Check the extents of every operand, and prepare every result, before any product is
+    //  computed, so that an error leaves no result partially computed.
+    //
+    for (size_t p = 0;  p < count;  ++p)
+    {
+        if (engine_support::sizes_differ(as[p].rows(), as[p].columns(), rows, inner)  ||
+            engine_support::sizes_differ(bs[p].rows(), bs[p].columns(), inner, cols))
+        {
+            throw runtime_error("mis-matched operand sizes for gemm_batched");
+        }
+        support::prepare_result(cs[p], rows, cols, be != element_type{});
+    }
+
+    if (max_threads == 0)
+    {
+        max_threads = std::max(std::thread::hardware_concurrency(), 1u);
+    }
+
+    detail::batch_executor::for_each(count, rows * cols * inner, [&](size_t p)
+    {
+        matrix_type_1 const&    a = as[p];
+        matrix_type_2 const&    b = bs[p];
+        matrix_type_r&          c = cs[p];
+
+        if (engine_support::overlap(c.engine(), a.engine())  ||
+            engine_support::overlap(c.engine(), b.engine()))
+        {
+            gemm(al, a, b, be, c);
+        }
+        else
+        {
+            support::multiply_batched(al, a, b, be, c);
+        }
+    },
+    max_threads);
+}
+
+
+//--------------------------------------------------------------------------------------------------
+//  Function:   gemm_batched(alpha, A, B, beta, C)
+//
+//  Computes C[p] = alpha*A[p]*B[p] + beta*C[p] for each p in [0, N), where A, B and C are
+//  rank-3 mdspans of dense, strided arrays indexed by (batch, row, column), so that A[p] is
+//  the submdspan A(p, :, :).  The caller owns the storage of C, and its extents must match
+//  those of the products.  The products are computed in parallel across the batch, as above.
+//--------------------------------------------------------------------------------------------------
+//
+template<class S1, class T1, class X1, class L1, class A1, class T2, class X2, class L2, class A2,
+         class S2, class TR, class XR, class LR, class AR>
+requires
+    detail::dense_batch_mdspan<mdspan<T1, X1, L1, A1>>
+    and
+    detail::dense_batch_mdspan<mdspan<T2, X2, L2, A2>>
+    and
+    detail::dense_batch_mdspan<mdspan<TR, XR, LR, AR>>
+    and
+    same_as<std::remove_const_t<T1>, TR>
+    and
+    same_as<std::remove_const_t<T2>, TR>
+void
+gemm_batched(S1 const& alpha, mdspan<T1, X1, L1, A1> const& a, mdspan<T2, X2, L2, A2> const& b,
+             S2 const& beta, mdspan<TR, XR, LR, AR> const& c, size_t max_threads = 0)
+{
+    using kernel_type  = detail::batched_gemm_kernel<TR>;
+    using operand_type = typename kernel_type::operand_type;
+    using result_type  = typename kernel_type::result_type;
+
+    TR const    al = static_cast<TR>(alpha);
+    TR const    be = static_cast<TR>(beta);
+
+    size_t const    count = static_cast<size_t>(c.extent(0));
+    size_t const    rows  = static_cast<size_t>(c.extent(1));
+    size_t const    cols  = static_cast<size_t>(c.extent(2));
+    size_t const    inner = static_cast<size_t>(a.extent(2));
+
+    if (static_cast<size_t>(a.extent(0)) != count  ||  static_cast<size_t>(b.extent(0)) != count)
+    {
+        throw runtime_error("mis-matched batch sizes for gemm_batched");
+    }
+    if (static_cast<size_t>(a.extent(1)) != rows   ||  static_cast<size_t>(b.extent(1)) != inner  ||
+        static_cast<size_t>(b.extent(2)) != cols)
+    {
+        throw runtime_error("mis-matched operand sizes for gemm_batched");
+    }
+    if (max_threads == 0)
+    {
+        max_threads = std::max(std::thread::hardware_concurrency(), 1u);
+    }
+
+    detail::batch_executor::for_each(count, rows * cols * inner, [&](size_t p)
+    {
+        kernel_type::multiply(al,
+                              operand_type{a.data_handle() + a.mapping()(p, 0, 0), rows, inner,
+                                           static_cast<size_t>(a.stride(1)),
+                                           static_cast<size_t>(a.stride(2))},
+                              operand_type{b.data_handle() + b.mapping()(p, 0, 0), inner, cols,
+                                           static_cast<size_t>(b.stride(1)),
+                                           static_cast<size_t>(b.stride(2))},
+                              be,
+                              result_type{c.data_handle() + c.mapping()(p, 0, 0), rows, cols,
+                                          static_cast<size_t>(c.stride(1)),
+                                          static_cast<size_t>(c.stride(2))});
+    },
+    max_threads);
+}
+
+
+//--------------------------------------------------------------------------------------------------
+//  Function:   axpy(alpha, X, Y)
+//
+//  Computes Y = alpha*X + Y, writing the result into the existing matrix Y, which must have
+//  the same extents as X.  If X refers to elements of Y at different indices, X is first
+//  copied to a temporary.
+//--------------------------------------------------------------------------------------------------
+//
+template<class S1, class ET1, class COT1, class ETR, class COTR>
+requires
+    detail::writable_matrix_engine<ETR>
+constexpr void
+axpy(S1 const& alpha, matrix<ET1, COT1> const& x, matrix<ETR, COTR>& y)
+{
+    using element_type   = typename ETR::element_type;
+    using support        = detail::blas_operation_support;
+    using engine_support = detail::matrix_engine_support;
+
+    element_type const  al = static_cast<element_type>(alpha);
+
+    if (engine_support::sizes_differ(x.rows(), x.columns(), y.rows(), y.columns()))
+    {
+        throw runtime_error("mis-matched operand sizes for axpy");
+    }
+
+    if (engine_support::may_alias(y.engine(), x.engine()))
+    {
+        support::axpy(al, matrix<detail::temporary_engine_t<ET1>, COT1>(x), y);
+    }
+    else
+    {
+        support::axpy(al, x, y);
+    }
+}
+
+
+//--------------------------------------------------------------------------------------------------
+//  Function:   scale(alpha, X)
+//
+//  Computes X = alpha*X in place, traversing X in the order of its layout.  Each element is
+//  computed as it would be by X*alpha and then converted to the element type.
+//--------------------------------------------------------------------------------------------------
+//
+template<class S1, class ETR, class COTR>
+requires
+    detail::writable_matrix_engine<ETR>
+constexpr void
+scale(S1 const& alpha, matrix<ETR, COTR>& x)
+{
+    detail::blas_operation_support::scale_in_place(alpha, x);
+}
+
+}       //- STD_LA namespace
+#endif  //- LINEAR_ALGEBRA_BLAS_OPERATIONS_HPP_DEFINED
@@ -17,6 +17,12 @@ namespace STD_LA {
 template<class T>
 struct matrix_scalar_engine;
 
+template<class OET, class OP, class ET1, class ET2>
+class matrix_expression_engine;
+
+template<class ET, class COT>
+class matrix_noalias_proxy;
+
 
 namespace detail {
 //==================================================================================================
@@ -151,6 +157,28 @@ template<class ET> inline constexpr
 bool    is_owning_engine_type_v = has_owning_engine_type_alias<ET>::is_owning;
 
 
+//--------------------------------------------------------------------------------------------------
+//  Trait:      is_matrix_expression_engine<ET>
+//  Variable:   is_matrix_expression_engine_v<ET>
+//
+//  This private traits type determines whether an engine type is a specialization of
+//  matrix_expression_engine.
+//--------------------------------------------------------------------------------------------------
+//
+template<class ET>
+struct is_matrix_expression_engine : public false_type
+{};
+
+template<class OET, class OP, class ET1, class ET2>
+struct is_matrix_expression_engine<matrix_expression_engine<OET, OP, ET1, ET2>> : public true_type
+{};
+
+//------
+//
+template<class ET> inline constexpr
+bool    is_matrix_expression_engine_v = is_matrix_expression_engine<ET>::value;
+
+
 //--------------------------------------------------------------------------------------------------
 //  The following are used to determine whether or not an engine type actually has constexpr
 //  size member functions.  This technique relies on the facts that: (1) a lambda can be
@@ -176,15 +204,45 @@ is_constexpr(...)
 }
 
 //------
+//  Since a default-constructed dynamically-sized engine may also be usable in a constant
+//  expression (e.g., if its storage is a std::vector), an engine whose rows or columns can be
+//  reshaped is never considered to have constexpr extents.
+//
+template<class ET> inline constexpr
+bool    has_reshapable_columns_v = requires (ET& eng) { eng.reshape_columns(0, 0); };
+
+template<class ET> inline constexpr
+bool    has_reshapable_rows_v = requires (ET& eng) { eng.reshape_rows(0, 0); };
+
+//------
+//  Likewise, a view engine whose extents are chosen when it is constructed, such as a submatrix
+//  view, reports extents of zero when default-constructed, and so its extents are never
+//  considered constexpr.  Such engines specialize this trait.
 //
+template<class ET>
+struct has_runtime_extents : public false_type
+{};
+
 template<class ET> inline constexpr
-bool    has_constexpr_columns_v = is_constexpr([]{ ET().columns(); });
+bool    has_runtime_extents_v = has_runtime_extents<ET>::value;
 
+//------
+//
 template<class ET> inline constexpr
-bool    has_constexpr_rows_v = is_constexpr([]{ ET().rows(); });
+bool    has_constexpr_columns_v = is_constexpr([]{ ET().columns(); })
+                                  and not has_reshapable_columns_v<ET>
+                                  and not has_runtime_extents_v<ET>;
 
 template<class ET> inline constexpr
-bool    has_constexpr_size_v = is_constexpr([]{ ET().size(); });
+bool    has_constexpr_rows_v = is_constexpr([]{ ET().rows(); })
+                               and not has_reshapable_rows_v<ET>
+                               and not has_runtime_extents_v<ET>;
+
+template<class ET> inline constexpr
+bool    has_constexpr_size_v = is_constexpr([]{ ET().size(); })
+                               and not has_reshapable_columns_v<ET>
+                               and not has_reshapable_rows_v<ET>
+                               and not has_runtime_extents_v<ET>;
 
 
 //--------------------------------------------------------------------------------------------------
@@ -219,23 +277,59 @@ struct engine_extents_helper
     static constexpr size_t
     columns()
     {
-        return get_value_helper([]{ return static_cast<size_t>(ET().columns()); });
+        if constexpr (has_runtime_extents_v<ET>)
+        {
+            return std::dynamic_extent;
+        }
+        else
+        {
+            return get_value_helper([]{ return static_cast<size_t>(ET().columns()); });
+        }
     }
 
     static constexpr size_t
     rows()
     {
-        return get_value_helper([]{ return static_cast<size_t>(ET().rows()); });
+        if constexpr (has_runtime_extents_v<ET>)
+        {
+            return std::dynamic_extent;
+        }
+        else
+        {
+            return get_value_helper([]{ return static_cast<size_t>(ET().rows()); });
+        }
     }
 
     static constexpr size_t
     size()
     {
-        return get_value_helper([]{ return static_cast<size_t>(ET().size()); });
+        if constexpr (has_runtime_extents_v<ET>)
+        {
+            return std::dynamic_extent;
+        }
+        else
+        {
+            return get_value_helper([]{ return static_cast<size_t>(ET().size()); });
+        }
     }
 };
 
 
+//--------------------------------------------------------------------------------------------------
+//  Concepts:   column_vector_engine<ET>
+//              row_vector_engine<ET>
+//
+//  These private concepts determine whether an engine type is known at compile time to have
+//  exactly one column, or exactly one row, respectively.
+//--------------------------------------------------------------------------------------------------
+//
+template<class ET>
+concept column_vector_engine = (engine_extents_helper<ET>::columns() == 1);
+
+template<class ET>
+concept row_vector_engine = (engine_extents_helper<ET>::rows() == 1);
+
+
 
 template<class ET, class = void>
 struct layout_type_extractor
@@ -987,6 +1081,35 @@ struct matrix_engine_support
 
         verify_and_reshape(dst, rows, cols);
 
+        //- Engines whose spans address their elements directly, such as submatrix views, are
+        //  copied through the spans' data handles and strides.
+        //
+        if constexpr (spannable_matrix_engine<ET1> and spannable_matrix_engine<ET2>
+                      and is_dense_mdspan_v<get_mdspan_type_t<ET1>>
+                      and is_dense_mdspan_v<get_const_mdspan_type_t<ET2>>)
+        {
+            if (not std::is_constant_evaluated())
+            {
+                copy_dense(dst.span(), src.span());
+                return;
+            }
+        }
+
+        //- Expressions whose operands are all dense, or scalars, are evaluated one line at a time
+        //  from flat pointers to the lines of their operands, if those are contiguous.
+        //
+        if constexpr (is_matrix_expression_engine_v<ET2>)
+        {
+            if constexpr (ET2::has_flat_lines  and  spannable_matrix_engine<ET1>
+                          and is_dense_mdspan_v<get_mdspan_type_t<ET1>>)
+            {
+                if (not std::is_constant_evaluated()  &&  evaluate_lines(dst.span(), src))
+                {
+                    return;
+                }
+            }
+        }
+
         size_type_dst   di = 0;
         size_type_src   si = 0;
 
@@ -1002,6 +1125,92 @@ struct matrix_engine_support
         }
     }
 
+    //- Copy the elements of the dense span SRC to those of the dense span DST, which have the
+    //  same extents, following DST's layout.  Rows (or columns) that are contiguous in both are
+    //  copied by a simple loop that the compiler can vectorize.  DST and SRC may be identical.
+    //
+    template<class DST, class SRC>
+    static void
+    copy_dense(DST const& dst, SRC const& src)
+    {
+        using elem_type = typename DST::element_type;
+
+        size_t  rows = static_cast<size_t>(dst.extent(0));
+        size_t  cols = static_cast<size_t>(dst.extent(1));
+        size_t  drs  = static_cast<size_t>(dst.stride(0));
+        size_t  dcs  = static_cast<size_t>(dst.stride(1));
+        size_t  srs  = static_cast<size_t>(src.stride(0));
+        size_t  scs  = static_cast<size_t>(src.stride(1));
+
+        if (drs == 1  &&  dcs != 1)
+        {
+            std::swap(rows, cols);
+            std::swap(drs, dcs);
+            std::swap(srs, scs);
+        }
+
+        for (size_t i = 0;  i < rows;  ++i)
+        {
+            elem_type* const    pd = dst.data_handle() + i*drs;
+            auto const* const   ps = src.data_handle() + i*srs;
+
+            if (dcs == 1  &&  scs == 1)
+            {
+                for (size_t j = 0;  j < cols;  ++j)
+                {
+                    pd[j] = static_cast<elem_type>(ps[j]);
+                }
+            }
+            else
+            {
+                for (size_t j = 0;  j < cols;  ++j)
+                {
+                    pd[j*dcs] = static_cast<elem_type>(ps[j*scs]);
+                }
+            }
+        }
+    }
+
+    //- Evaluate the expression SRC into the dense span DST, which have the same extents, one
+    //  row (or column) of DST's layout at a time, as described for matrix_expression_engine.
+    //  Returns false, having written nothing, if the rows (or columns) of DST or of any operand
+    //  of SRC are not contiguous.
+    //
+    template<class DST, class ET>
+    static bool
+    evaluate_lines(DST const& dst, ET const& src)
+    {
+        using elem_type = typename DST::element_type;
+
+        size_t  rows = static_cast<size_t>(dst.extent(0));
+        size_t  cols = static_cast<size_t>(dst.extent(1));
+        size_t  drs  = static_cast<size_t>(dst.stride(0));
+        size_t  dcs  = static_cast<size_t>(dst.stride(1));
+        bool    by_cols = (drs == 1  &&  dcs != 1);
+
+        if (by_cols)
+        {
+            std::swap(rows, cols);
+            std::swap(drs, dcs);
+        }
+        if (dcs != 1  ||  not src.flat_lines(by_cols))
+        {
+            return false;
+        }
+
+        for (size_t i = 0;  i < rows;  ++i)
+        {
+            elem_type* const    pd   = dst.data_handle() + i*drs;
+            auto const          line = src.line(static_cast<typename ET::size_type>(i), by_cols);
+
+            for (size_t j = 0;  j < cols;  ++j)
+            {
+                pd[j] = static_cast<elem_type>(line[j]);
+            }
+        }
+        return true;
+    }
+
     template<class ET, class U, class IT, size_t X0, size_t X1, class SL, class SA>
     static constexpr void
     assign_from(ET& dst, mdspan<U, extents<IT, X0, X1>, SL, SA> const& src)
@@ -1214,6 +1423,165 @@ struct matrix_engine_support
         }
     }
 
+    //----------------------------------------------------------------------------------------------
+    //  These member functions determine whether the elements of two engines may occupy the same
+    //  storage.  overlap() is true if writing to an element of DST may change any element of
+    //  SRC.  may_alias() is true if writing to an element of DST may change an element of SRC
+    //  having a different index; if it is false, DST may be updated element-wise from SRC in
+    //  place, as in A = A + B or A = -A.
+    //
+    //  Distinct owning engines never share elements.  Expression engines are checked through
+    //  their operands, and engines that expose their elements through span() are compared by
+    //  the range of addresses their spans cover.  Any other pair of engines, and any pair of
+    //  spans compared during constant evaluation, is assumed to overlap.
+    //----------------------------------------------------------------------------------------------
+    //
+    template<class ET1, class ET2>
+    static constexpr bool
+    overlap(ET1 const& dst, ET2 const& src) noexcept
+    {
+        if constexpr (is_owning_engine_type_v<ET1> and is_owning_engine_type_v<ET2>)
+        {
+            return static_cast<void const*>(std::addressof(dst)) ==
+                   static_cast<void const*>(std::addressof(src));
+        }
+        else if constexpr (is_matrix_expression_engine_v<ET2>)
+        {
+            return src.any_operand([&dst](auto const& eng) { return overlap(dst, eng); });
+        }
+        else if constexpr (spannable_matrix_engine<ET1> and spannable_matrix_engine<ET2>)
+        {
+            return spans_overlap(dst.span(), src.span());
+        }
+        else
+        {
+            return true;
+        }
+    }
+
+    template<class ET1, class ET2>
+    static constexpr bool
+    may_alias(ET1 const& dst, ET2 const& src) noexcept
+    {
+        if constexpr (is_owning_engine_type_v<ET1> and is_owning_engine_type_v<ET2>)
+        {
+            return false;
+        }
+        else if constexpr (is_matrix_expression_engine_v<ET2>)
+        {
+            return src.any_operand([&dst](auto const& eng) { return may_alias(dst, eng); });
+        }
+        else if constexpr (spannable_matrix_engine<ET1> and spannable_matrix_engine<ET2>)
+        {
+            auto const  ds = dst.span();
+            auto const  ss = src.span();
+
+            if (static_cast<void const*>(ds.data_handle()) == static_cast<void const*>(ss.data_handle())
+                &&  ds.stride(0) == ss.stride(0)  &&  ds.stride(1) == ss.stride(1))
+            {
+                return false;
+            }
+            return spans_overlap(ds, ss);
+        }
+        else
+        {
+            return true;
+        }
+    }
+
+    template<class ST1, class ST2>
+    static constexpr bool
+    spans_overlap(ST1 const& s1, ST2 const& s2) noexcept
+    {
+        if (s1.extent(0) == 0  ||  s1.extent(1) == 0  ||  s2.extent(0) == 0  ||  s2.extent(1) == 0)
+        {
+            return false;
+        }
+        else if (std::is_constant_evaluated())
+        {
+            return true;
+        }
+        else
+        {
+            auto const  first = [](auto const& s)
+            {
+                return static_cast<char const*>(static_cast<void const*>(s.data_handle()));
+            };
+            auto const  last = [](auto const& s)
+            {
+                using elem_type = typename std::remove_cvref_t<decltype(s)>::element_type;
+
+                size_t const    i = static_cast<size_t>(s.extent(0) - 1);
+                size_t const    j = static_cast<size_t>(s.extent(1) - 1);
+                size_t const    n = i * static_cast<size_t>(s.stride(0))
+                                  + j * static_cast<size_t>(s.stride(1)) + 1;
+
+                return static_cast<char const*>(static_cast<void const*>(s.data_handle()))
+                       + n * sizeof(elem_type);
+            };
+            std::less<char const*> const    before;
+
+            if (not (before(first(s1), last(s2))  &&  before(first(s2), last(s1))))
+            {
+                return false;
+            }
+            return tiles_overlap(s1, s2, first(s2) - first(s1));
+        }
+    }
+
+    //- Determine whether two spans whose address ranges intersect actually share an element.
+    //  This is exact for spans having the same strides, one of them 1, whose rows (or columns)
+    //  do not interleave -- e.g., two submatrices of one matrix, which are disjoint tiles in a
+    //  blocked algorithm even though their address ranges intersect.  Otherwise the spans are
+    //  assumed to overlap.  OFFSET is the distance in bytes from the first element of S1 to the
+    //  first element of S2.
+    //
+    template<class ST1, class ST2>
+    static constexpr bool
+    tiles_overlap(ST1 const& s1, ST2 const& s2, ptrdiff_t offset) noexcept
+    {
+        using elem_type_1 = typename ST1::element_type;
+        using elem_type_2 = typename ST2::element_type;
+
+        constexpr ptrdiff_t     size = static_cast<ptrdiff_t>(sizeof(elem_type_1));
+
+        if (sizeof(elem_type_1) != sizeof(elem_type_2)  ||  offset % size != 0  ||
+            s1.stride(0) != s2.stride(0)  ||  s1.stride(1) != s2.stride(1))
+        {
+            return true;
+        }
+
+        //- With unit stride along the columns, element (i, j) of S2 lies at element
+        //  d + i*ld + j from the first element of S1, and lies in S1 if that is also i1*ld + j1
+        //  for some (i1, j1) in S1.  Writing q = i1 - i, this requires q*ld - d = j - j1, which
+        //  lies in [-(c1 - 1), c2 - 1]; since ld is at least c1 and c2, at most two values of q
+        //  need be checked against [-(r2 - 1), r1 - 1].
+        //
+        bool const      by_rows = (s1.stride(1) == 1);
+        ptrdiff_t const ld = static_cast<ptrdiff_t>((by_rows) ? s1.stride(0) : s1.stride(1));
+        ptrdiff_t const r1 = static_cast<ptrdiff_t>((by_rows) ? s1.extent(0) : s1.extent(1));
+        ptrdiff_t const c1 = static_cast<ptrdiff_t>((by_rows) ? s1.extent(1) : s1.extent(0));
+        ptrdiff_t const r2 = static_cast<ptrdiff_t>((by_rows) ? s2.extent(0) : s2.extent(1));
+        ptrdiff_t const c2 = static_cast<ptrdiff_t>((by_rows) ? s2.extent(1) : s2.extent(0));
+        ptrdiff_t const d  = offset / size;
+
+        if ((not by_rows  &&  s1.stride(0) != 1)  ||  ld < c1  ||  ld < c2)
+        {
+            return true;
+        }
+
+        ptrdiff_t const lo = d - (c1 - 1);
+        ptrdiff_t       q  = lo / ld;
+
+        if (q*ld < lo) ++q;
+
+        for (;  q*ld <= d + (c2 - 1);  ++q)
+        {
+            if (-(r2 - 1) <= q  &&  q <= r1 - 1) return true;
+        }
+        return false;
+    }
+
     //----------------------------------------------------------------------------------------------
     //  These member functions compare the contents of matrix engines with those of other matrix
     //  engines, 2-D mdspans, and 2-D initializer lists.
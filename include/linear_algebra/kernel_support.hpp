@@ -0,0 +1,3342 @@
+//==================================================================================================
+//  File:       kernel_support.hpp
+//
+//  Summary:    This header defines a number of private types and functions that implement the
+//              computational kernels used by the arithmetic traits when their operands provide
+//              direct access to their elements through mdspan.
+//==================================================================================================
+//
+#ifndef LINEAR_ALGEBRA_KERNEL_SUPPORT_HPP_DEFINED
+#define LINEAR_ALGEBRA_KERNEL_SUPPORT_HPP_DEFINED
+
+namespace STD_LA {
+namespace detail {
+//==================================================================================================
+//  TYPES AND TRAITS DEFINITIONS -- DENSE OPERANDS
+//==================================================================================================
+//--------------------------------------------------------------------------------------------------
+//  Concept:    dense_matrix_engine<ET>
+//
+//  This private concept determines whether a matrix engine type is spannable, and whether the
+//  mdspans returned by its span() member functions provide direct access to its elements.
+//  Engines fulfilling this concept may be used as operands by the dense kernels defined below.
+//--------------------------------------------------------------------------------------------------
+//
+template<class ET>
+concept dense_matrix_engine =
+    spannable_matrix_engine<ET>
+    and
+    is_dense_mdspan_v<typename ET::mdspan_type>
+    and
+    is_dense_mdspan_v<typename ET::const_mdspan_type>;
+
+
+//--------------------------------------------------------------------------------------------------
+//  Concept:    gemm_element<T>
+//
+//  This private concept determines whether an element type may be used with the packed GEMM
+//  kernel defined below.  Element types must be non-boolean arithmetic types, or specializations
+//  of std::complex.
+//--------------------------------------------------------------------------------------------------
+//
+template<class T>
+concept gemm_element =
+    (std::is_arithmetic_v<T> and not same_as<T, bool>)
+    or
+    is_complex_v<T>;
+
+
+//--------------------------------------------------------------------------------------------------
+//  Concept:    gemm_engines<ETR, ET1, ET2>
+//
+//  This private concept determines whether the packed GEMM kernel may be used to compute the
+//  product of engines of types ET1 and ET2 into an engine of type ETR.  All three must be dense
+//  engines having the same element type, which must be a GEMM element type.
+//--------------------------------------------------------------------------------------------------
+//
+template<class ETR, class ET1, class ET2>
+concept gemm_engines =
+    dense_matrix_engine<ETR>
+    and
+    dense_matrix_engine<ET1>
+    and
+    dense_matrix_engine<ET2>
+    and
+    gemm_element<typename ETR::element_type>
+    and
+    same_as<typename ETR::element_type, typename ET1::element_type>
+    and
+    same_as<typename ETR::element_type, typename ET2::element_type>;
+
+
+//--------------------------------------------------------------------------------------------------
+//  Trait:      operand_mdspan_traits<T>
+//
+//  This private traits type determines whether an mdspan type addresses the elements of a dense
+//  array through any number of negating and conjugating accessors, as do the spans of negation,
+//  conjugate, and hermitian views (and of views of such views), and if so, whether the elements
+//  read through it are negated or conjugated.  A transpose is already expressed by the strides
+//  of the span's layout mapping.  Thus, a span of this kind may be unwrapped into a pointer, a
+//  pair of strides, and a pair of flags, as BLAS describes its operands; the kernels apply the
+//  flags to the elements as they read them, or fold the negation into a scalar coefficient.
+//  Conjugation is the identity for non-complex elements, and is never reported for them.
+//--------------------------------------------------------------------------------------------------
+//
+template<class MA>
+struct operand_accessor_traits
+{
+    static constexpr bool   direct     = false;
+    static constexpr bool   negated    = false;
+    static constexpr bool   conjugated = false;
+};
+
+template<class T>
+struct operand_accessor_traits<MDSPAN_NS::default_accessor<T>>
+{
+    static constexpr bool   direct     = true;
+    static constexpr bool   negated    = false;
+    static constexpr bool   conjugated = false;
+};
+
+template<class T, class WA>
+struct operand_accessor_traits<negation_accessor<T, WA>>
+{
+    static constexpr bool   direct     = operand_accessor_traits<WA>::direct;
+    static constexpr bool   negated    = not operand_accessor_traits<WA>::negated;
+    static constexpr bool   conjugated = operand_accessor_traits<WA>::conjugated;
+};
+
+template<class T, class WA>
+struct operand_accessor_traits<conjugate_accessor<T, WA>>
+{
+    static constexpr bool   direct     = operand_accessor_traits<WA>::direct;
+    static constexpr bool   negated    = operand_accessor_traits<WA>::negated;
+    static constexpr bool   conjugated = (operand_accessor_traits<WA>::conjugated !=
+                                          is_complex_v<std::remove_const_t<T>>);
+};
+
+//------
+//
+template<class T>
+struct operand_mdspan_traits : public operand_accessor_traits<void>
+{};
+
+template<class T, class IT, size_t X0, size_t X1, class ML, class MA>
+struct operand_mdspan_traits<mdspan<T, extents<IT, X0, X1>, ML, MA>>
+:   public operand_accessor_traits<MA>
+{};
+
+
+//--------------------------------------------------------------------------------------------------
+//  Concepts:   view_operand_engine<ET>
+//              view_gemm_engines<ETR, ET1, ET2>
+//              complex_gemm_engines<ETR, ET1, ET2>
+//              view_addition_engines<ETR, ET1, ET2>
+//
+//  The first concept determines whether an engine is spannable, and whether its const mdspan
+//  may be unwrapped as described above; i.e., whether it is a dense engine, or a transpose,
+//  negation, conjugate, or hermitian view of one.  The second determines whether the packed
+//  GEMM kernel may be used to compute the product of engines of types ET1 and ET2 into an
+//  engine of type ETR; the result must be a dense engine, and the operands may be views of
+//  dense engines, since the kernel conjugates the operands as it packs them and folds their
+//  negations into the coefficient alpha.  All three must have the same element type, which must
+//  be a GEMM element type.  The third concept further requires that the element type be complex,
+//  as for the split complex kernel.  The fourth instead requires that neither operand be
+//  conjugated, as for the element-wise kernels, which apply only negation.
+//--------------------------------------------------------------------------------------------------
+//
+template<class ET>
+concept view_operand_engine =
+    spannable_matrix_engine<ET>
+    and
+    operand_mdspan_traits<typename ET::const_mdspan_type>::direct;
+
+template<class ETR, class ET1, class ET2>
+concept view_gemm_engines =
+    dense_matrix_engine<ETR>
+    and
+    view_operand_engine<ET1>
+    and
+    view_operand_engine<ET2>
+    and
+    gemm_element<typename ETR::element_type>
+    and
+    same_as<typename ETR::element_type, typename ET1::element_type>
+    and
+    same_as<typename ETR::element_type, typename ET2::element_type>;
+
+template<class ETR, class ET1, class ET2>
+concept complex_gemm_engines =
+    view_gemm_engines<ETR, ET1, ET2>
+    and
+    is_complex_v<typename ETR::element_type>;
+
+template<class ETR, class ET1, class ET2>
+concept view_addition_engines =
+    view_gemm_engines<ETR, ET1, ET2>
+    and
+    not operand_mdspan_traits<typename ET1::const_mdspan_type>::conjugated
+    and
+    not operand_mdspan_traits<typename ET2::const_mdspan_type>::conjugated;
+
+
+//--------------------------------------------------------------------------------------------------
+//  Class Template:     dense_operand<T>
+//
+//  This private type describes a dense, two-dimensional array of elements of type T whose
+//  elements are addressed by a pointer and a pair of strides.  It is used to pass matrix
+//  operands to the computational kernels in a form that is independent of engine type.
+//--------------------------------------------------------------------------------------------------
+//
+template<class T>
+struct dense_operand
+{
+    using element_type = T;
+
+    T*      data;
+    size_t  rows;
+    size_t  cols;
+    size_t  row_stride;
+    size_t  col_stride;
+
+    constexpr T&
+    operator ()(size_t i, size_t j) const noexcept
+    {
+        return data[i*row_stride + j*col_stride];
+    }
+
+    constexpr bool
+    has_unit_stride() const noexcept
+    {
+        return (row_stride == 1  ||  col_stride == 1);
+    }
+
+    constexpr dense_operand
+    transposed() const noexcept
+    {
+        return dense_operand{data, cols, rows, col_stride, row_stride};
+    }
+
+    constexpr
+    operator dense_operand<T const>() const noexcept
+    requires
+        (not std::is_const_v<T>)
+    {
+        return dense_operand<T const>{data, rows, cols, row_stride, col_stride};
+    }
+};
+
+//------
+//
+template<class ST>
+constexpr auto
+make_dense_operand(ST const& s) noexcept
+{
+    using elem_type = typename ST::element_type;
+
+    return dense_operand<elem_type>{s.data_handle(),
+                                    static_cast<size_t>(s.extent(0)),
+                                    static_cast<size_t>(s.extent(1)),
+                                    static_cast<size_t>(s.stride(0)),
+                                    static_cast<size_t>(s.stride(1))};
+}
+
+
+//--------------------------------------------------------------------------------------------------
+//  Class Template:     view_operand<T>
+//
+//  This private type describes a dense operand together with flags that indicate whether its
+//  elements are to be conjugated and negated as they are read, so that the kernels can accept
+//  negation, conjugate, and hermitian views of dense engines without copying them.
+//--------------------------------------------------------------------------------------------------
+//
+template<class T>
+struct view_operand
+{
+    dense_operand<T const>  op;
+    bool                    conj;
+    bool                    negate;
+};
+
+//------
+//
+template<class ST>
+constexpr auto
+make_view_operand(ST const& s) noexcept
+{
+    using elem_type = std::remove_const_t<typename ST::element_type>;
+    using traits    = operand_mdspan_traits<ST>;
+
+    return view_operand<elem_type>{make_dense_operand(s), traits::conjugated, traits::negated};
+}
+
+
+//==================================================================================================
+//  TYPES AND TRAITS DEFINITIONS -- PACKED GEMM
+//==================================================================================================
+//--------------------------------------------------------------------------------------------------
+//  Class Template:     gemm_blocking_traits<T>
+//
+//  This private traits type specifies the register-block and cache-block sizes used by the
+//  packed GEMM kernel for element type T.  The register block of the portable micro-kernel is
+//  MR rows by NR columns; the cache blocks are chosen so that a KC x NR sliver of packed B stays
+//  in half of L1, an MC x KC block of packed A stays in half of L2, and a KC x NC panel of packed
+//  B stays in a share of L3.  Since all of these depend on sizeof(T) and on the register block
+//  of the micro-kernel actually in use, each element type and micro-kernel gets its own blocking.
+//
+//  The member `min_work` is the value of M*N*K below which the cost of packing is not recovered,
+//  and the arithmetic traits use a simple loop nest instead.  The member `min_thread_work` is
+//  the least value of M*N*K assigned to each thread when a product is computed in parallel.
+//--------------------------------------------------------------------------------------------------
+//
+template<class T>
+struct gemm_blocking_traits
+{
+    static constexpr size_t     l1_bytes = 32u * 1024u;
+    static constexpr size_t     l2_bytes = 256u * 1024u;
+    static constexpr size_t     l3_bytes = 4u * 1024u * 1024u;
+
+    static constexpr size_t     mr = (is_complex_v<T>) ? 2 : (sizeof(T) <= 4) ? 8 : 4;
+    static constexpr size_t     nr = (is_complex_v<T>) ? 2 : 4;
+
+    static constexpr size_t     min_work        = 16u * 16u * 16u;
+    static constexpr size_t     min_thread_work = 64u * 64u * 64u;
+
+    static constexpr size_t
+    kc(size_t nr) noexcept
+    {
+        return std::max<size_t>(((l1_bytes/2) / (nr * sizeof(T))) & ~size_t(7), 16);
+    }
+
+    static constexpr size_t
+    mc(size_t mr, size_t kc) noexcept
+    {
+        return std::max<size_t>(((l2_bytes/2) / (kc * sizeof(T))) / mr * mr, mr);
+    }
+
+    static constexpr size_t
+    nc(size_t nr, size_t kc) noexcept
+    {
+        return std::max<size_t>(((l3_bytes/4) / (kc * sizeof(T))) / nr * nr, nr);
+    }
+};
+
+
+//--------------------------------------------------------------------------------------------------
+//  Class Template:     gemm_micro_kernel<T>
+//
+//  This private type describes a register-blocked micro-kernel that computes the MR x NR
+//  product of an MR-row sliver of packed A and an NR-column sliver of packed B, each of depth
+//  K.  The product is written, column-major, to an MR x NR tile supplied by the caller.
+//
+//  The register-block sizes are carried along with the function pointer so that the packing
+//  routines can lay out their buffers to match whichever micro-kernel is in use.
+//--------------------------------------------------------------------------------------------------
+//
+template<class T>
+struct gemm_micro_kernel
+{
+    using kernel_function = void (*)(size_t k, T const* a, T const* b, T* ab);
+
+    size_t              mr;
+    size_t              nr;
+    kernel_function     kernel;
+};
+
+//--------------------------------------------------------------------------------------------------
+//  Class Template:     simd_gemm_micro_kernel<T>
+//
+//  This private traits type selects a SIMD micro-kernel for element type T that is suited to
+//  the host CPU.  The primary template simply returns the portable micro-kernel it is given;
+//  specializations for the element types having SIMD micro-kernels are in simd_support.hpp.
+//--------------------------------------------------------------------------------------------------
+//
+template<class T>
+struct simd_gemm_micro_kernel
+{
+    static gemm_micro_kernel<T>
+    select(gemm_micro_kernel<T> const& fallback) noexcept
+    {
+        return fallback;
+    }
+};
+
+
+//--------------------------------------------------------------------------------------------------
+//  Class Template:     gemm_workspace<T>
+//
+//  This private type holds the buffers used to pack panels of A and B.  One workspace exists per
+//  thread and element type; its buffers only grow, so that repeated products of similar size do
+//  not allocate.
+//--------------------------------------------------------------------------------------------------
+//
+template<class T>
+struct gemm_workspace
+{
+    std::vector<T>  a_panel;
+    std::vector<T>  b_panel;
+
+    static gemm_workspace&
+    local()
+    {
+        static thread_local gemm_workspace  ws;
+        return ws;
+    }
+
+    void
+    reserve(size_t a_size, size_t b_size)
+    {
+        if (a_panel.size() < a_size) a_panel.resize(a_size);
+        if (b_panel.size() < b_size) b_panel.resize(b_size);
+    }
+};
+
+
+//--------------------------------------------------------------------------------------------------
+//  Class:      parallel_runner
+//
+//  This private type runs a number of independent tasks, one per thread, with the calling thread
+//  running the first.  Every thread that was started is joined before run() returns, including
+//  when starting a thread fails, and an exception thrown by a task is rethrown in the caller
+//  once all of the threads have finished.
+//--------------------------------------------------------------------------------------------------
+//
+struct parallel_runner
+{
+    //- Invoke FN(t) for each t in [0, tasks), each on a thread of its own.
+    //
+    template<class FN>
+    static void
+    run(size_t tasks, FN&& fn)
+    {
+        //- Joins every started worker when it goes out of scope, however that happens.
+        //
+        struct worker_group
+        {
+            std::vector<std::thread>    threads;
+
+            ~worker_group()
+            {
+                for (auto& w : threads)
+                {
+                    if (w.joinable()) w.join();
+                }
+            }
+        };
+
+        std::vector<std::exception_ptr> errors(tasks);
+
+        auto    run_task = [&](size_t t)
+        {
+            try
+            {
+                fn(t);
+            }
+            catch (...)
+            {
+                errors[t] = std::current_exception();
+            }
+        };
+
+        {
+            worker_group    workers;
+
+            workers.threads.reserve(tasks - 1);
+
+            for (size_t t = 1;  t < tasks;  ++t)
+            {
+                workers.threads.emplace_back(run_task, t);
+            }
+            run_task(0);
+        }
+
+        for (auto& e : errors)
+        {
+            if (e) std::rethrow_exception(e);
+        }
+    }
+};
+
+
+//--------------------------------------------------------------------------------------------------
+//  Class Template:     gemm_kernel<T>
+//
+//  This private type implements a cache-blocked, packed matrix-matrix product of the form
+//  C = alpha*A*B + beta*C, after the fashion of Goto and van de Geijn.  Panels of B and blocks
+//  of A are copied into contiguous buffers sized to fit in the caches, zero-padded at the edges,
+//  and then multiplied by a register-blocked micro-kernel.  If beta is zero, C is not read.
+//--------------------------------------------------------------------------------------------------
+//
+template<class T>
+struct gemm_kernel
+{
+    using blocking_traits = gemm_blocking_traits<T>;
+    using operand_type    = dense_operand<T const>;
+    using result_type     = dense_operand<T>;
+    using micro_kernel    = gemm_micro_kernel<T>;
+
+    static constexpr size_t     max_mr = 32;
+    static constexpr size_t     max_nr = 16;
+
+    static constexpr size_t     symmetric_block = 128;
+
+    //- The portable micro-kernel, which accumulates in a local array that the compiler can
+    //  keep in registers.
+    //
+    template<size_t MR, size_t NR>
+    static void
+    generic_micro_kernel(size_t k, T const* a, T const* b, T* ab)
+    {
+        T   acc[MR*NR] = {};
+
+        for (size_t p = 0;  p < k;  ++p, a += MR, b += NR)
+        {
+            for (size_t i = 0;  i < MR;  ++i)
+            {
+                T const     ai = a[i];
+
+                for (size_t j = 0;  j < NR;  ++j)
+                {
+                    acc[i*NR + j] += ai * b[j];
+                }
+            }
+        }
+
+        for (size_t i = 0;  i < MR;  ++i)
+        {
+            for (size_t j = 0;  j < NR;  ++j)
+            {
+                ab[j*MR + i] = acc[i*NR + j];
+            }
+        }
+    }
+
+    static micro_kernel
+    generic_micro_kernel() noexcept
+    {
+        constexpr size_t    mr = blocking_traits::mr;
+        constexpr size_t    nr = blocking_traits::nr;
+
+        return micro_kernel{mr, nr, &generic_micro_kernel<mr, nr>};
+    }
+
+    //- Prefer a SIMD micro-kernel for the host CPU, if one exists for this element type.
+    //
+    static micro_kernel
+    select_micro_kernel() noexcept
+    {
+        static micro_kernel const   uk = simd_gemm_micro_kernel<T>::select(generic_micro_kernel());
+        return uk;
+    }
+
+    //- Return the complex conjugate of E if CONJ is set; real elements are returned as is.
+    //
+    static constexpr T
+    conjugate_if(T const& e, bool conj) noexcept
+    {
+        if constexpr (is_complex_v<T>)
+        {
+            return (conj) ? std::conj(e) : e;
+        }
+        else
+        {
+            return e;
+        }
+    }
+
+    //- Copy an M x K block of A into MR-row slivers, each stored column by column, converting
+    //  the elements to T, and conjugating them if CONJ is set.
+    //
+    template<class U>
+    static void
+    pack_a(dense_operand<U const> a, size_t mr, T* ap, bool conj = false)
+    {
+        for (size_t i0 = 0;  i0 < a.rows;  i0 += mr)
+        {
+            size_t const    mi = std::min(mr, a.rows - i0);
+
+            for (size_t p = 0;  p < a.cols;  ++p)
+            {
+                size_t  i = 0;
+
+                for (;  i < mi;  ++i)
+                {
+                    *ap++ = conjugate_if(static_cast<T>(a(i0 + i, p)), conj);
+                }
+                for (;  i < mr;  ++i)
+                {
+                    *ap++ = T{};
+                }
+            }
+        }
+    }
+
+    //- Copy a K x N panel of B into NR-column slivers, each stored row by row, converting the
+    //  elements to T, and conjugating them if CONJ is set.
+    //
+    template<class U>
+    static void
+    pack_b(dense_operand<U const> b, size_t nr, T* bp, bool conj = false)
+    {
+        for (size_t j0 = 0;  j0 < b.cols;  j0 += nr)
+        {
+            size_t const    nj = std::min(nr, b.cols - j0);
+
+            for (size_t p = 0;  p < b.rows;  ++p)
+            {
+                size_t  j = 0;
+
+                for (;  j < nj;  ++j)
+                {
+                    *bp++ = conjugate_if(static_cast<T>(b(p, j0 + j)), conj);
+                }
+                for (;  j < nr;  ++j)
+                {
+                    *bp++ = T{};
+                }
+            }
+        }
+    }
+
+    //- Merge a micro-tile into the valid region of C.
+    //
+    static void
+    update_tile(result_type c, size_t i0, size_t j0, size_t mi, size_t nj, size_t mr,
+                T const* ab, T const& alpha, T const& beta)
+    {
+        bool const  no_beta  = (beta == T{});
+        bool const  one_beta = (beta == T{1});
+
+        for (size_t j = 0;  j < nj;  ++j)
+        {
+            for (size_t i = 0;  i < mi;  ++i)
+            {
+                T&  cij = c(i0 + i, j0 + j);
+
+                if (no_beta)
+                    cij = alpha * ab[j*mr + i];
+                else if (one_beta)
+                    cij = cij + alpha * ab[j*mr + i];
+                else
+                    cij = beta * cij + alpha * ab[j*mr + i];
+            }
+        }
+    }
+
+    //- Multiply C by beta; used when there is no product to accumulate.
+    //
+    static void
+    scale(result_type c, T const& beta)
+    {
+        for (size_t i = 0;  i < c.rows;  ++i)
+        {
+            for (size_t j = 0;  j < c.cols;  ++j)
+            {
+                c(i, j) = (beta == T{}) ? T{} : beta * c(i, j);
+            }
+        }
+    }
+
+    //- Compute C = alpha*op(A)*op(B) + beta*C using the given micro-kernel, where op() is the
+    //  identity, or element-wise conjugation if the corresponding flag is set.
+    //
+    static void
+    multiply(T const& alpha, operand_type a, operand_type b, T const& beta, result_type c,
+             micro_kernel const& uk, bool conj_a = false, bool conj_b = false)
+    {
+        size_t const    m = c.rows;
+        size_t const    n = c.cols;
+        size_t const    k = a.cols;
+
+        if (m == 0  ||  n == 0) return;
+
+        if (k == 0  ||  alpha == T{})
+        {
+            scale(c, beta);
+            return;
+        }
+
+        size_t const    mr = uk.mr;
+        size_t const    nr = uk.nr;
+        size_t const    kc = blocking_traits::kc(nr);
+        size_t const    mc = blocking_traits::mc(mr, kc);
+        size_t const    nc = blocking_traits::nc(nr, kc);
+
+        gemm_workspace<T>&  ws = gemm_workspace<T>::local();
+        T                   ab[max_mr * max_nr];
+
+        ws.reserve(std::min(mc, (m + mr - 1) / mr * mr) * std::min(kc, k),
+                   std::min(kc, k) * std::min(nc, (n + nr - 1) / nr * nr));
+
+        for (size_t jc = 0;  jc < n;  jc += nc)
+        {
+            size_t const    nb = std::min(nc, n - jc);
+
+            for (size_t pc = 0;  pc < k;  pc += kc)
+            {
+                size_t const    kb     = std::min(kc, k - pc);
+                T const         beta_p = (pc == 0) ? beta : T{1};
+
+                pack_b(operand_type{&b(pc, jc), kb, nb, b.row_stride, b.col_stride}, nr, ws.b_panel.data(),
+                       conj_b);
+
+                for (size_t ic = 0;  ic < m;  ic += mc)
+                {
+                    size_t const    mb = std::min(mc, m - ic);
+
+                    pack_a(operand_type{&a(ic, pc), mb, kb, a.row_stride, a.col_stride}, mr, ws.a_panel.data(),
+                           conj_a);
+
+                    for (size_t jr = 0;  jr < nb;  jr += nr)
+                    {
+                        size_t const    nj = std::min(nr, nb - jr);
+                        T const*        bp = ws.b_panel.data() + jr*kb;
+
+                        for (size_t ir = 0;  ir < mb;  ir += mr)
+                        {
+                            size_t const    mi = std::min(mr, mb - ir);
+                            T const*        ap = ws.a_panel.data() + ir*kb;
+
+                            uk.kernel(kb, ap, bp, ab);
+                            update_tile(c, ic + ir, jc + jr, mi, nj, mr, ab, alpha, beta_p);
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    static void
+    multiply(T const& alpha, operand_type a, operand_type b, T const& beta, result_type c)
+    {
+        multiply(alpha, a, b, beta, c, select_micro_kernel());
+    }
+
+    //- Compute C = alpha*op(A)*op(B) + beta*C, where the operands are views of dense arrays.
+    //  Conjugation is applied as the operands are packed, and negation is folded into alpha,
+    //  which is exact, so that neither view is copied.  If B addresses the elements of A's
+    //  transpose, as in A*A.t() or A.h()*A, and beta is zero, then the product is symmetric
+    //  (or Hermitian, if alpha is real), and only one triangle of it is computed.
+    //
+    static void
+    multiply(T const& alpha, view_operand<T> a, view_operand<T> b, T const& beta, result_type c)
+    {
+        T const             signed_alpha = (a.negate != b.negate) ? T(-alpha) : alpha;
+        micro_kernel const  uk = select_micro_kernel();
+        bool const          herm = (a.conj != b.conj);
+
+        if (beta == T{}  &&  is_transpose_of(a.op, b.op)  &&
+            (not herm  ||  conjugate_if(signed_alpha, true) == signed_alpha))
+        {
+            symmetric_multiply(signed_alpha, a.op, beta, c, uk, a.conj, b.conj);
+        }
+        else
+        {
+            multiply(signed_alpha, a.op, b.op, beta, c, uk, a.conj, b.conj);
+        }
+    }
+
+    //- Determine whether B addresses the same elements as the transpose of A.
+    //
+    static constexpr bool
+    is_transpose_of(operand_type a, operand_type b) noexcept
+    {
+        return a.data == b.data  &&  a.rows == b.cols  &&  a.cols == b.rows  &&
+               a.row_stride == b.col_stride  &&  a.col_stride == b.row_stride;
+    }
+
+    //- Compute C = alpha*op(A)*op(A^T) + beta*C, where C is symmetric, or Hermitian if exactly
+    //  one of the flags is set, as does BLAS xSYRK/xHERK.  The lower triangle is computed one
+    //  block of rows at a time, each by a single call to the packed kernel that stops at the
+    //  diagonal block, so that only about half the multiply-adds of the full product are done;
+    //  the lower triangle is then copied to the upper.  The diagonal elements of a Hermitian
+    //  result are made real.  When n <= symmetric_block the full product is computed instead,
+    //  and so all of C is read, as is the upper part of each diagonal block otherwise; but the
+    //  elements computed from the strict upper triangle of C are then overwritten, and so the
+    //  result depends only on the lower triangle of C.
+    //
+    static void
+    symmetric_multiply(T const& alpha, operand_type a, T const& beta, result_type c,
+                       micro_kernel const& uk, bool conj_a, bool conj_b)
+    {
+        size_t const    n    = c.rows;
+        bool const      herm = (conj_a != conj_b);
+
+        if (n == 0) return;
+
+        if (a.cols == 0  ||  n <= symmetric_block)
+        {
+            multiply(alpha, a, a.transposed(), beta, c, uk, conj_a, conj_b);
+        }
+        else
+        {
+            for (size_t i0 = 0;  i0 < n;  i0 += symmetric_block)
+            {
+                size_t const    ib = std::min(symmetric_block, n - i0);
+                operand_type    ai{&a(i0, 0), ib, a.cols, a.row_stride, a.col_stride};
+                operand_type    bt{a.data, a.cols, i0 + ib, a.col_stride, a.row_stride};
+                result_type     ci{&c(i0, 0), ib, i0 + ib, c.row_stride, c.col_stride};
+
+                multiply(alpha, ai, bt, beta, ci, uk, conj_a, conj_b);
+            }
+        }
+
+        for (size_t i = 0;  i < n;  ++i)
+        {
+            if constexpr (is_complex_v<T>)
+            {
+                if (herm) c(i, i) = T(c(i, i).real());
+            }
+            for (size_t j = 0;  j < i;  ++j)
+            {
+                c(j, i) = conjugate_if(c(i, j), herm);
+            }
+        }
+    }
+
+    //- Compute C = alpha*A*B + beta*C using at most max_threads threads.  C is partitioned into
+    //  a grid of tiles, one per thread, whose edges fall on register-block boundaries; the
+    //  grid is chosen to use as many threads as possible while keeping the tiles close to
+    //  square, which minimizes the amount of A and B that each thread must pack.  The calling
+    //  thread computes the first tile.
+    //
+    static void
+    parallel_multiply(T const& alpha, operand_type a, operand_type b, T const& beta, result_type c,
+                      size_t max_threads)
+    {
+        micro_kernel const  uk = select_micro_kernel();
+
+        size_t const    m = c.rows;
+        size_t const    n = c.cols;
+        size_t const    k = a.cols;
+        size_t const    row_tiles = (m + uk.mr - 1) / uk.mr;
+        size_t const    col_tiles = (n + uk.nr - 1) / uk.nr;
+        size_t const    threads   = std::min({max_threads,
+                                              (m * n * k) / blocking_traits::min_thread_work,
+                                              row_tiles * col_tiles});
+        if (threads <= 1)
+        {
+            multiply(alpha, a, b, beta, c, uk);
+            return;
+        }
+
+        size_t  grid_rows = 1;
+        size_t  grid_cols = 1;
+        size_t  best_cost = std::numeric_limits<size_t>::max();
+
+        for (size_t pr = 1;  pr <= std::min(threads, row_tiles);  ++pr)
+        {
+            size_t const    pc   = std::min(threads / pr, col_tiles);
+            size_t const    cost = m / pr + n / pc;
+
+            if (pr * pc > grid_rows * grid_cols  ||  (pr * pc == grid_rows * grid_cols  &&  cost < best_cost))
+            {
+                grid_rows = pr;
+                grid_cols = pc;
+                best_cost = cost;
+            }
+        }
+
+        parallel_runner::run(grid_rows * grid_cols, [&](size_t t)
+        {
+            size_t const    ti = t / grid_cols;
+            size_t const    tj = t % grid_cols;
+            size_t const    i0 = std::min(m, (ti * row_tiles / grid_rows) * uk.mr);
+            size_t const    i1 = std::min(m, ((ti + 1) * row_tiles / grid_rows) * uk.mr);
+            size_t const    j0 = std::min(n, (tj * col_tiles / grid_cols) * uk.nr);
+            size_t const    j1 = std::min(n, ((tj + 1) * col_tiles / grid_cols) * uk.nr);
+
+            multiply(alpha,
+                     operand_type{&a(i0, 0), i1 - i0, k, a.row_stride, a.col_stride},
+                     operand_type{&b(0, j0), k, j1 - j0, b.row_stride, b.col_stride},
+                     beta,
+                     result_type{&c(i0, j0), i1 - i0, j1 - j0, c.row_stride, c.col_stride},
+                     uk);
+        });
+    }
+};
+
+
+//--------------------------------------------------------------------------------------------------
+//  Class Template:     mixed_gemm_kernel<T, AT>
+//
+//  This private type computes C = alpha*A*B + beta*C for elements of type T, accumulating in
+//  the wider type AT, as when the multiplication element traits name such an accumulator type.
+//  The elements of A and B are converted to AT as their blocks are packed, so that operands
+//  are never converted as a whole, and the products are computed by the micro-kernel for AT.
+//
+//  Unlike gemm_kernel<T>, the loop over K is the innermost of the cache-block loops, so that
+//  each block of C accumulates all of its terms in a buffer of type AT and is rounded to T
+//  only once.  The cost is that each panel of B is packed once per block of rows of C.
+//--------------------------------------------------------------------------------------------------
+//
+template<class T, class AT>
+struct mixed_gemm_kernel
+{
+    using blocking_traits = gemm_blocking_traits<AT>;
+    using operand_type    = dense_operand<T const>;
+    using result_type     = dense_operand<T>;
+    using packing_kernel  = gemm_kernel<AT>;
+
+    static void
+    multiply(T const& alpha, operand_type a, operand_type b, T const& beta, result_type c)
+    {
+        size_t const    m = c.rows;
+        size_t const    n = c.cols;
+        size_t const    k = a.cols;
+
+        if (m == 0  ||  n == 0) return;
+
+        auto const      uk = packing_kernel::select_micro_kernel();
+        size_t const    mr = uk.mr;
+        size_t const    nr = uk.nr;
+        size_t const    kc = blocking_traits::kc(nr);
+        size_t const    mc = blocking_traits::mc(mr, kc);
+        size_t const    nc = blocking_traits::nc(nr, kc);
+
+        gemm_workspace<AT>&     ws  = gemm_workspace<AT>::local();
+        std::vector<AT>&        acc = accumulator();
+        AT                      ab[packing_kernel::max_mr * packing_kernel::max_nr];
+
+        ws.reserve(std::min(mc, (m + mr - 1) / mr * mr) * std::min(kc, k),
+                   std::min(kc, k) * std::min(nc, (n + nr - 1) / nr * nr));
+
+        if (acc.size() < std::min(mc, m) * std::min(nc, n))
+        {
+            acc.resize(std::min(mc, m) * std::min(nc, n));
+        }
+
+        AT const    al      = static_cast<AT>(alpha);
+        AT const    be      = static_cast<AT>(beta);
+        bool const  no_beta = (beta == T{});
+
+        for (size_t jc = 0;  jc < n;  jc += nc)
+        {
+            size_t const    nb = std::min(nc, n - jc);
+
+            for (size_t ic = 0;  ic < m;  ic += mc)
+            {
+                size_t const    mb = std::min(mc, m - ic);
+
+                std::fill_n(acc.data(), mb*nb, AT{});
+
+                for (size_t pc = 0;  pc < k;  pc += kc)
+                {
+                    size_t const    kb = std::min(kc, k - pc);
+
+                    packing_kernel::pack_b(operand_type{&b(pc, jc), kb, nb, b.row_stride, b.col_stride},
+                                           nr, ws.b_panel.data());
+                    packing_kernel::pack_a(operand_type{&a(ic, pc), mb, kb, a.row_stride, a.col_stride},
+                                           mr, ws.a_panel.data());
+
+                    for (size_t jr = 0;  jr < nb;  jr += nr)
+                    {
+                        size_t const    nj = std::min(nr, nb - jr);
+                        AT const*       bp = ws.b_panel.data() + jr*kb;
+
+                        for (size_t ir = 0;  ir < mb;  ir += mr)
+                        {
+                            size_t const    mi = std::min(mr, mb - ir);
+                            AT const*       ap = ws.a_panel.data() + ir*kb;
+
+                            uk.kernel(kb, ap, bp, ab);
+
+                            for (size_t i = 0;  i < mi;  ++i)
+                            {
+                                for (size_t j = 0;  j < nj;  ++j)
+                                {
+                                    acc[(ir + i)*nb + jr + j] += ab[j*mr + i];
+                                }
+                            }
+                        }
+                    }
+                }
+
+                for (size_t i = 0;  i < mb;  ++i)
+                {
+                    for (size_t j = 0;  j < nb;  ++j)
+                    {
+                        T&          cij = c(ic + i, jc + j);
+                        AT const    v   = al * acc[i*nb + j];
+
+                        cij = static_cast<T>((no_beta) ? v : v + be * static_cast<AT>(cij));
+                    }
+                }
+            }
+        }
+    }
+
+  private:
+    static std::vector<AT>&
+    accumulator()
+    {
+        static thread_local std::vector<AT>     acc;
+        return acc;
+    }
+};
+
+
+//==================================================================================================
+//  TYPES AND TRAITS DEFINITIONS -- STRASSEN-WINOGRAD GEMM
+//==================================================================================================
+//--------------------------------------------------------------------------------------------------
+//  Class Template:     strassen_kernel<T>
+//
+//  This private type computes C = A*B by the Winograd variant of Strassen's algorithm, which
+//  forms the product from seven products of half-size blocks and fifteen block additions.  The
+//  recursion stops once any dimension is no larger than a cutoff, and the remaining products are
+//  computed by the packed GEMM kernel.  An odd dimension is handled by peeling off its last row
+//  or column, whose contribution is then computed by the packed kernel.
+//
+//  The steps are scheduled after Boyer, Dumas, Pernet and Zhou, so that each level of recursion
+//  needs only two temporaries -- one the size of a block of A, the other the size of a block of
+//  B -- with the remaining intermediate values held in the quadrants of C.  The temporaries for
+//  all levels are carved from a single per-thread workspace that is sized before the recursion
+//  begins, and that only grows.
+//
+//  The rounding errors of this algorithm differ from, and are in the worst case larger than,
+//  those of the conventional product, so it is used only when explicitly selected.
+//--------------------------------------------------------------------------------------------------
+//
+template<class T>
+struct strassen_kernel
+{
+    using operand_type = dense_operand<T const>;
+    using result_type  = dense_operand<T>;
+    using gemm_type    = gemm_kernel<T>;
+
+    //- Compute C = A*B, recursing while all of M, N, and K exceed the cutoff.
+    //
+    static void
+    multiply(operand_type a, operand_type b, result_type c, size_t cutoff)
+    {
+        cutoff = std::max<size_t>(cutoff, 1);
+
+        std::vector<T>&     ws = workspace();
+        size_t const        ws_size = workspace_size(c.rows, a.cols, c.cols, cutoff);
+
+        if (ws.size() < ws_size) ws.resize(ws_size);
+
+        recurse(a, b, c, cutoff, ws.data());
+    }
+
+    //- The number of elements of workspace needed to compute an M x K by K x N product.
+    //
+    static constexpr size_t
+    workspace_size(size_t m, size_t k, size_t n, size_t cutoff) noexcept
+    {
+        size_t  size = 0;
+
+        while (m > cutoff  &&  k > cutoff  &&  n > cutoff)
+        {
+            m /= 2;
+            k /= 2;
+            n /= 2;
+            size += m * std::max(k, n) + k * n;
+        }
+        return size;
+    }
+
+  private:
+    static std::vector<T>&
+    workspace()
+    {
+        static thread_local std::vector<T>  ws;
+        return ws;
+    }
+
+    template<class U>
+    static constexpr dense_operand<U>
+    block(dense_operand<U> x, size_t i, size_t j, size_t rows, size_t cols) noexcept
+    {
+        return dense_operand<U>{&x(i, j), rows, cols, x.row_stride, x.col_stride};
+    }
+
+    //- Compute Z = X + Y, or Z = X - Y; Z may be the same as X or Y.
+    //
+    template<bool Subtract>
+    static void
+    combine(result_type z, operand_type x, operand_type y)
+    {
+        bool const      by_rows = (z.col_stride == 1);
+        size_t const    outer   = (by_rows) ? z.rows : z.cols;
+        size_t const    inner   = (by_rows) ? z.cols : z.rows;
+
+        for (size_t o = 0;  o < outer;  ++o)
+        {
+            for (size_t p = 0;  p < inner;  ++p)
+            {
+                size_t const    i = (by_rows) ? o : p;
+                size_t const    j = (by_rows) ? p : o;
+
+                if constexpr (Subtract)
+                    z(i, j) = x(i, j) - y(i, j);
+                else
+                    z(i, j) = x(i, j) + y(i, j);
+            }
+        }
+    }
+
+    static void
+    add(result_type z, operand_type x, operand_type y)
+    {
+        combine<false>(z, x, y);
+    }
+
+    static void
+    subtract(result_type z, operand_type x, operand_type y)
+    {
+        combine<true>(z, x, y);
+    }
+
+    static void
+    recurse(operand_type a, operand_type b, result_type c, size_t cutoff, T* ws)
+    {
+        size_t const    m = c.rows;
+        size_t const    n = c.cols;
+        size_t const    k = a.cols;
+
+        if (m <= cutoff  ||  n <= cutoff  ||  k <= cutoff)
+        {
+            gemm_type::multiply(T{1}, a, b, T{}, c);
+            return;
+        }
+
+        size_t const    mh = m / 2;
+        size_t const    nh = n / 2;
+        size_t const    kh = k / 2;
+
+        operand_type const  a11 = block(a, 0,  0,  mh, kh);
+        operand_type const  a12 = block(a, 0,  kh, mh, kh);
+        operand_type const  a21 = block(a, mh, 0,  mh, kh);
+        operand_type const  a22 = block(a, mh, kh, mh, kh);
+        operand_type const  b11 = block(b, 0,  0,  kh, nh);
+        operand_type const  b12 = block(b, 0,  nh, kh, nh);
+        operand_type const  b21 = block(b, kh, 0,  kh, nh);
+        operand_type const  b22 = block(b, kh, nh, kh, nh);
+        result_type const   c11 = block(c, 0,  0,  mh, nh);
+        result_type const   c12 = block(c, 0,  nh, mh, nh);
+        result_type const   c21 = block(c, mh, 0,  mh, nh);
+        result_type const   c22 = block(c, mh, nh, mh, nh);
+
+        //- X holds a block of A, and later a block of C; Y holds a block of B.
+        //
+        result_type const   x  = result_type{ws, mh, kh, kh, 1};
+        result_type const   xc = result_type{ws, mh, nh, nh, 1};
+        result_type const   y  = result_type{ws + mh*std::max(kh, nh), kh, nh, nh, 1};
+        T* const            next = y.data + kh*nh;
+
+        subtract(x, a11, a21);                  //- S3 = A11 - A21
+        subtract(y, b22, b12);                  //- T3 = B22 - B12
+        recurse(x, y, c21, cutoff, next);       //- P7 = S3*T3
+        add(x, a21, a22);                       //- S1 = A21 + A22
+        subtract(y, b12, b11);                  //- T1 = B12 - B11
+        recurse(x, y, c22, cutoff, next);       //- P5 = S1*T1
+        subtract(x, x, a11);                    //- S2 = S1 - A11
+        subtract(y, b22, y);                    //- T2 = B22 - T1
+        recurse(x, y, c12, cutoff, next);       //- P6 = S2*T2
+        subtract(x, a12, x);                    //- S4 = A12 - S2
+        recurse(x, b22, c11, cutoff, next);     //- P3 = S4*B22
+        recurse(a11, b11, xc, cutoff, next);    //- P1 = A11*B11
+        add(c12, xc, c12);                      //- U2 = P1 + P6
+        add(c21, c12, c21);                     //- U3 = U2 + P7
+        add(c12, c12, c22);                     //- U4 = U2 + P5
+        add(c22, c21, c22);                     //- C22 = U3 + P5
+        add(c12, c12, c11);                     //- C12 = U4 + P3
+        subtract(y, y, b21);                    //- T4 = T2 - B21
+        recurse(a22, y, c11, cutoff, next);     //- P4 = A22*T4
+        subtract(c21, c21, c11);                //- C21 = U3 - P4
+        recurse(a12, b21, c11, cutoff, next);   //- P2 = A12*B21
+        add(c11, xc, c11);                      //- C11 = P1 + P2
+
+        //- Fix up the peeled row and column of C, and add the contribution of the peeled column
+        //  of A and row of B to the rest of it.
+        //
+        size_t const    me = 2*mh;
+        size_t const    ne = 2*nh;
+        size_t const    ke = 2*kh;
+
+        if (ke < k)
+        {
+            gemm_type::multiply(T{1}, block(a, 0, ke, me, 1), block(b, ke, 0, 1, ne),
+                                T{1}, block(c, 0, 0, me, ne));
+        }
+        if (ne < n)
+        {
+            gemm_type::multiply(T{1}, block(a, 0, 0, me, k), block(b, 0, ne, k, 1),
+                                T{}, block(c, 0, ne, me, 1));
+        }
+        if (me < m)
+        {
+            gemm_type::multiply(T{1}, block(a, me, 0, 1, k), b, T{}, block(c, me, 0, 1, n));
+        }
+    }
+};
+
+//==================================================================================================
+//  TYPES AND TRAITS DEFINITIONS -- SPLIT COMPLEX GEMM
+//==================================================================================================
+//--------------------------------------------------------------------------------------------------
+//  Enumeration:        complex_gemm_algorithm
+//
+//  This private type selects how the split complex GEMM kernel forms each product of real and
+//  imaginary parts: four_m uses four real products, and three_m uses the three real products
+//  of Karatsuba's method.
+//--------------------------------------------------------------------------------------------------
+//
+enum class complex_gemm_algorithm
+{
+    four_m,
+    three_m
+};
+
+
+//--------------------------------------------------------------------------------------------------
+//  Class Template:     split_complex_gemm_kernel<T>
+//
+//  This private type computes C = alpha*op(A)*op(B) + beta*C, where the elements are of complex
+//  type T and op() is either the identity or element-wise conjugation, by way of real products.
+//  Blocks of A and B are split into separate planes of real and imaginary parts, conjugating as
+//  they are copied, and the planes are multiplied by the packed GEMM kernel for the underlying
+//  real type, which may use that type's SIMD micro-kernels.  Writing A = Ar + iAi and B = Br +
+//  iBi, the four_m algorithm computes
+//
+//      Re(AB) = Ar*Br - Ai*Bi,     Im(AB) = Ar*Bi + Ai*Br,
+//
+//  and the three_m algorithm computes, with T1 = Ar*Br, T2 = Ai*Bi, and T3 = (Ar+Ai)*(Br+Bi),
+//
+//      Re(AB) = T1 - T2,           Im(AB) = T3 - T1 - T2.
+//
+//  The three_m algorithm does 25% less arithmetic, but its imaginary parts are subject to
+//  cancellation, and so it is used only when explicitly selected.  (Since the SIMD complex
+//  micro-kernels already run at nearly the rate of the real ones, the four_m algorithm is not
+//  used by default; gemm_kernel<T> multiplies interleaved complex elements directly.)  The
+//  planes and partial products are held in a per-thread workspace, which only grows.
+//--------------------------------------------------------------------------------------------------
+//
+template<class T>
+struct split_complex_gemm_kernel
+{
+    using real_type    = typename T::value_type;
+    using operand_type = view_operand<T>;
+    using result_type  = dense_operand<T>;
+    using real_kernel  = gemm_kernel<real_type>;
+    using real_operand = dense_operand<real_type const>;
+    using real_result  = dense_operand<real_type>;
+
+    static constexpr size_t     mc = 256;
+    static constexpr size_t     nc = 256;
+    static constexpr size_t     kc = 256;
+
+    static constexpr size_t     min_work = gemm_blocking_traits<T>::min_work;
+
+    static void
+    multiply(T const& alpha, operand_type a, operand_type b, T const& beta, result_type c,
+             complex_gemm_algorithm algo = complex_gemm_algorithm::four_m)
+    {
+        size_t const    m = c.rows;
+        size_t const    n = c.cols;
+        size_t const    k = a.op.cols;
+
+        //- Negation of either operand is folded into alpha, as by gemm_kernel<T>.
+        //
+        T const     signed_alpha = (a.negate != b.negate) ? -alpha : alpha;
+
+        if (m == 0  ||  n == 0) return;
+
+        if (k == 0  ||  alpha == T{})
+        {
+            gemm_kernel<T>::scale(c, beta);
+            return;
+        }
+
+        bool const      three_m = (algo == complex_gemm_algorithm::three_m);
+        size_t const    a_size  = std::min(mc, m) * std::min(kc, k);
+        size_t const    b_size  = std::min(kc, k) * std::min(nc, n);
+        size_t const    c_size  = std::min(mc, m) * std::min(nc, n);
+
+        std::vector<real_type>&     ws = workspace();
+
+        if (ws.size() < 3*(a_size + b_size + c_size)) ws.resize(3*(a_size + b_size + c_size));
+
+        real_type* const    ar = ws.data();
+        real_type* const    ai = ar + a_size;
+        real_type* const    as = ai + a_size;
+        real_type* const    br = as + a_size;
+        real_type* const    bi = br + b_size;
+        real_type* const    bs = bi + b_size;
+        real_type* const    t1 = bs + b_size;
+        real_type* const    t2 = t1 + c_size;
+        real_type* const    t3 = t2 + c_size;
+
+        for (size_t jc = 0;  jc < n;  jc += nc)
+        {
+            size_t const    nb = std::min(nc, n - jc);
+
+            for (size_t pc = 0;  pc < k;  pc += kc)
+            {
+                size_t const    kb     = std::min(kc, k - pc);
+                T const         beta_p = (pc == 0) ? beta : T{1};
+
+                split(block(b.op, pc, jc, kb, nb), b.conj, br, bi, (three_m) ? bs : nullptr);
+
+                for (size_t ic = 0;  ic < m;  ic += mc)
+                {
+                    size_t const    mb = std::min(mc, m - ic);
+
+                    split(block(a.op, ic, pc, mb, kb), a.conj, ar, ai, (three_m) ? as : nullptr);
+
+                    real_operand const  pa_r{ar, mb, kb, kb, 1};
+                    real_operand const  pa_i{ai, mb, kb, kb, 1};
+                    real_operand const  pb_r{br, kb, nb, nb, 1};
+                    real_operand const  pb_i{bi, kb, nb, nb, 1};
+                    real_result const   p1{t1, mb, nb, nb, 1};
+                    real_result const   p2{t2, mb, nb, nb, 1};
+                    real_result const   p3{t3, mb, nb, nb, 1};
+
+                    if (three_m)
+                    {
+                        real_operand const  pa_s{as, mb, kb, kb, 1};
+                        real_operand const  pb_s{bs, kb, nb, nb, 1};
+
+                        real_kernel::multiply(1, pa_r, pb_r, 0, p1);
+                        real_kernel::multiply(1, pa_i, pb_i, 0, p2);
+                        real_kernel::multiply(1, pa_s, pb_s, 0, p3);
+
+                        for (size_t i = 0;  i < mb;  ++i)
+                        {
+                            for (size_t j = 0;  j < nb;  ++j)
+                            {
+                                p3(i, j) = p3(i, j) - p1(i, j) - p2(i, j);
+                                p1(i, j) = p1(i, j) - p2(i, j);
+                            }
+                        }
+                    }
+                    else
+                    {
+                        real_kernel::multiply(1, pa_r, pb_r, 0, p1);
+                        real_kernel::multiply(-1, pa_i, pb_i, 1, p1);
+                        real_kernel::multiply(1, pa_r, pb_i, 0, p3);
+                        real_kernel::multiply(1, pa_i, pb_r, 1, p3);
+                    }
+
+                    merge(signed_alpha, p1, p3, beta_p, block(c, ic, jc, mb, nb));
+                }
+            }
+        }
+    }
+
+  private:
+    static std::vector<real_type>&
+    workspace()
+    {
+        static thread_local std::vector<real_type>  ws;
+        return ws;
+    }
+
+    template<class U>
+    static constexpr dense_operand<U>
+    block(dense_operand<U> x, size_t i, size_t j, size_t rows, size_t cols) noexcept
+    {
+        return dense_operand<U>{&x(i, j), rows, cols, x.row_stride, x.col_stride};
+    }
+
+    //- Copy the real and imaginary parts of X, conjugated if requested, into row-major planes;
+    //  if S is non-null, also store the sum of the parts.
+    //
+    static void
+    split(dense_operand<T const> x, bool conj, real_type* re, real_type* im, real_type* s)
+    {
+        real_type const     sign = (conj) ? real_type{-1} : real_type{1};
+
+        for (size_t i = 0;  i < x.rows;  ++i)
+        {
+            for (size_t j = 0;  j < x.cols;  ++j)
+            {
+                T const             e = x(i, j);
+                real_type const     r = e.real();
+                real_type const     v = sign * e.imag();
+
+                *re++ = r;
+                *im++ = v;
+                if (s != nullptr) *s++ = r + v;
+            }
+        }
+    }
+
+    //- Compute C = alpha*(Re + i*Im) + beta*C; if beta is zero, C is not read.
+    //
+    static void
+    merge(T const& alpha, real_result re, real_result im, T const& beta, result_type c)
+    {
+        bool const  no_beta = (beta == T{});
+
+        for (size_t i = 0;  i < c.rows;  ++i)
+        {
+            for (size_t j = 0;  j < c.cols;  ++j)
+            {
+                T const     p = alpha * T(re(i, j), im(i, j));
+                T&          cij = c(i, j);
+
+                cij = (no_beta) ? p : beta * cij + p;
+            }
+        }
+    }
+};
+
+
+
+//==================================================================================================
+//  TYPES AND TRAITS DEFINITIONS -- VECTOR KERNELS
+//==================================================================================================
+//--------------------------------------------------------------------------------------------------
+//  Class Template:     vector_kernels<T>
+//  Class Template:     simd_vector_kernels<T>
+//
+//  These private types describe the unit-stride dot product and AXPY (y = alpha*x + y) kernels
+//  used by the matrix-vector kernel, and select SIMD versions of them suited to the host CPU.
+//  As with the GEMM micro-kernels, the primary template of simd_vector_kernels<T> returns the
+//  portable kernels it is given; its specializations are in simd_support.hpp.
+//--------------------------------------------------------------------------------------------------
+//
+template<class T>
+struct vector_kernels
+{
+    using dot_function  = T (*)(size_t n, T const* x, T const* y);
+    using axpy_function = void (*)(size_t n, T alpha, T const* x, T* y);
+
+    dot_function    dot;
+    axpy_function   axpy;
+};
+
+//------
+//
+template<class T>
+struct simd_vector_kernels
+{
+    static vector_kernels<T>
+    select(vector_kernels<T> const& fallback) noexcept
+    {
+        return fallback;
+    }
+};
+
+
+//--------------------------------------------------------------------------------------------------
+//  Class Template:     gemv_kernel<T>
+//
+//  This private type implements dot products and matrix-vector products of the form y = A*x
+//  over dense operands.  Products of the form x^T*A are computed as A^T*x, by transposing the
+//  operand description.  Each is a single streaming pass over A: a row-major A is traversed
+//  as a sequence of dot products, and a column-major A as a sequence of AXPY updates to y, so
+//  that A is always read contiguously.
+//--------------------------------------------------------------------------------------------------
+//
+template<class T>
+struct gemv_kernel
+{
+    using operand_type = dense_operand<T const>;
+    using result_type  = dense_operand<T>;
+    using kernels_type = vector_kernels<T>;
+
+    //- The portable kernels.  The dot product keeps four partial sums, so that consecutive
+    //  multiply-adds do not depend on one another.
+    //
+    static T
+    generic_dot(size_t n, T const* x, T const* y)
+    {
+        T       s0{}, s1{}, s2{}, s3{};
+        size_t  i = 0;
+
+        for (;  i + 4 <= n;  i += 4)
+        {
+            s0 = s0 + x[i]   * y[i];
+            s1 = s1 + x[i+1] * y[i+1];
+            s2 = s2 + x[i+2] * y[i+2];
+            s3 = s3 + x[i+3] * y[i+3];
+        }
+        for (;  i < n;  ++i)
+        {
+            s0 = s0 + x[i] * y[i];
+        }
+        return (s0 + s1) + (s2 + s3);
+    }
+
+    static void
+    generic_axpy(size_t n, T alpha, T const* x, T* y)
+    {
+        for (size_t i = 0;  i < n;  ++i)
+        {
+            y[i] = y[i] + alpha * x[i];
+        }
+    }
+
+    //- Prefer SIMD kernels for the host CPU, if they exist for this element type.
+    //
+    static kernels_type const&
+    select_kernels() noexcept
+    {
+        static kernels_type const   vk =
+            simd_vector_kernels<T>::select(kernels_type{&generic_dot, &generic_axpy});
+        return vk;
+    }
+
+    //- Compute the dot product of n elements of x and y, which may be strided.
+    //
+    static T
+    dot(size_t n, T const* x, size_t incx, T const* y, size_t incy)
+    {
+        if (incx == 1  &&  incy == 1)
+        {
+            return select_kernels().dot(n, x, y);
+        }
+
+        T   s{};
+
+        for (size_t i = 0;  i < n;  ++i, x += incx, y += incy)
+        {
+            s = s + (*x) * (*y);
+        }
+        return s;
+    }
+
+    //- Compute y = A*x, where y has A.rows elements and x has A.cols elements.
+    //
+    static void
+    multiply(operand_type a, T const* x, size_t incx, T* y, size_t incy)
+    {
+        if (a.row_stride == 1  &&  a.col_stride != 1  &&  incy == 1)
+        {
+            auto const  axpy = select_kernels().axpy;
+
+            std::fill_n(y, a.rows, T{});
+
+            for (size_t j = 0;  j < a.cols;  ++j)
+            {
+                axpy(a.rows, x[j*incx], &a(0, j), y);
+            }
+        }
+        else
+        {
+            for (size_t i = 0;  i < a.rows;  ++i)
+            {
+                y[i*incy] = dot(a.cols, &a(i, 0), a.col_stride, x, incx);
+            }
+        }
+    }
+
+    //- Compute Y = alpha*X + Y, where X and Y have the same extents, one contiguous row or
+    //  column at a time if their layouts permit.
+    //
+    static void
+    axpy(T const& alpha, operand_type x, result_type y)
+    {
+        auto const  axpy = select_kernels().axpy;
+
+        if (x.col_stride == 1  &&  y.col_stride == 1)
+        {
+            for (size_t i = 0;  i < y.rows;  ++i)
+            {
+                axpy(y.cols, alpha, &x(i, 0), &y(i, 0));
+            }
+        }
+        else if (x.row_stride == 1  &&  y.row_stride == 1)
+        {
+            for (size_t j = 0;  j < y.cols;  ++j)
+            {
+                axpy(y.rows, alpha, &x(0, j), &y(0, j));
+            }
+        }
+        else
+        {
+            for (size_t i = 0;  i < y.rows;  ++i)
+            {
+                for (size_t j = 0;  j < y.cols;  ++j)
+                {
+                    y(i, j) = y(i, j) + alpha * x(i, j);
+                }
+            }
+        }
+    }
+
+    //- Compute Y = op1(X1) + op2(X2), where X1, X2, and Y have the same extents, and op() is
+    //  either the identity or negation, as indicated by the flags.  The operands may have any
+    //  strides, as do the spans of transpose views, and are traversed in the order of Y's layout.
+    //
+    static void
+    add(operand_type x1, bool neg1, operand_type x2, bool neg2, result_type y)
+    {
+        if (neg1)
+        {
+            if (neg2)
+            {
+                transform(x1, x2, y, [](T const& a, T const& b) -> T { return (-a) + (-b); });
+            }
+            else
+            {
+                transform(x1, x2, y, [](T const& a, T const& b) -> T { return (-a) + b; });
+            }
+        }
+        else
+        {
+            if (neg2)
+            {
+                transform(x1, x2, y, [](T const& a, T const& b) -> T { return a + (-b); });
+            }
+            else
+            {
+                transform(x1, x2, y, [](T const& a, T const& b) -> T { return a + b; });
+            }
+        }
+    }
+
+    //- Compute X = -X, which is exact, unlike multiplication by -1 for complex elements.
+    //
+    static void
+    negate(result_type x)
+    {
+        transform(x, x, x, [](T const& a, T const&) -> T { return -a; });
+    }
+
+    //- Compute X = alpha*X, one contiguous row or column at a time if its layout permits.
+    //
+    static void
+    scale(T const& alpha, result_type x)
+    {
+        if (x.col_stride == 1)
+        {
+            for (size_t i = 0;  i < x.rows;  ++i)
+            {
+                T* const    px = &x(i, 0);
+
+                for (size_t j = 0;  j < x.cols;  ++j)
+                {
+                    px[j] = alpha * px[j];
+                }
+            }
+        }
+        else if (x.row_stride == 1)
+        {
+            for (size_t j = 0;  j < x.cols;  ++j)
+            {
+                T* const    px = &x(0, j);
+
+                for (size_t i = 0;  i < x.rows;  ++i)
+                {
+                    px[i] = alpha * px[i];
+                }
+            }
+        }
+        else
+        {
+            for (size_t i = 0;  i < x.rows;  ++i)
+            {
+                for (size_t j = 0;  j < x.cols;  ++j)
+                {
+                    x(i, j) = alpha * x(i, j);
+                }
+            }
+        }
+    }
+
+    //- Compute X = X/alpha, one contiguous row or column at a time if its layout permits.
+    //
+    static void
+    divide(result_type x, T const& alpha)
+    {
+        transform(x, x, x, [&alpha](T const& a, T const&) -> T { return a / alpha; });
+    }
+
+  private:
+    //- Compute Y(i, j) = op(X1(i, j), X2(i, j)) for each element, one row or column of Y at a
+    //  time, with a separate loop for contiguous operands that the compiler can vectorize.
+    //
+    template<class OP>
+    static void
+    transform(operand_type x1, operand_type x2, result_type y, OP op)
+    {
+        bool const  by_cols = (y.row_stride == 1  &&  y.col_stride != 1);
+
+        if (by_cols)
+        {
+            x1 = x1.transposed();
+            x2 = x2.transposed();
+            y  = y.transposed();
+        }
+
+        for (size_t i = 0;  i < y.rows;  ++i)
+        {
+            T const* const  p1 = x1.data + i*x1.row_stride;
+            T const* const  p2 = x2.data + i*x2.row_stride;
+            T* const        py = y.data + i*y.row_stride;
+
+            if (x1.col_stride == 1  &&  x2.col_stride == 1  &&  y.col_stride == 1)
+            {
+                for (size_t j = 0;  j < y.cols;  ++j)
+                {
+                    py[j] = op(p1[j], p2[j]);
+                }
+            }
+            else
+            {
+                for (size_t j = 0;  j < y.cols;  ++j)
+                {
+                    py[j*y.col_stride] = op(p1[j*x1.col_stride], p2[j*x2.col_stride]);
+                }
+            }
+        }
+    }
+};
+
+
+//==================================================================================================
+//  TYPES AND TRAITS DEFINITIONS -- SPARSE KERNELS
+//==================================================================================================
+//--------------------------------------------------------------------------------------------------
+//  Concepts:   csr_matrix_engine<ET>
+//              csc_matrix_engine<ET>
+//              compressed_matrix_engine<ET>
+//              sell_matrix_engine<ET>
+//              sparse_product_engines<ETR, ET1, ET2>
+//
+//  The first two private concepts determine whether an engine stores its elements in compressed
+//  sparse row or compressed sparse column form, respectively, and exposes the three arrays that
+//  describe them, as does sparse_matrix_engine.  The fourth determines whether an engine stores
+//  its elements in sliced ELLPACK form, as does sliced_ellpack_engine.  The last determines
+//  whether the sparse kernels below may be used to compute the product of such an engine of
+//  type ET1 and a dense engine of type ET2 into a dense engine of type ETR.  All three must have
+//  the same element type, which must be a GEMM element type.
+//--------------------------------------------------------------------------------------------------
+//
+template<class ET>
+concept csr_matrix_engine =
+    readable_matrix_engine<ET>
+    and
+    requires (ET const& eng)
+    {
+        typename ET::index_type;
+        { eng.nonzeros()       } -> same_as<typename ET::size_type>;
+        { eng.row_offsets()    } -> same_as<std::span<typename ET::index_type const>>;
+        { eng.column_indices() } -> same_as<std::span<typename ET::index_type const>>;
+        { eng.values()         } -> same_as<std::span<typename ET::element_type const>>;
+    };
+
+template<class ET>
+concept csc_matrix_engine =
+    readable_matrix_engine<ET>
+    and
+    requires (ET const& eng)
+    {
+        typename ET::index_type;
+        { eng.nonzeros()       } -> same_as<typename ET::size_type>;
+        { eng.column_offsets() } -> same_as<std::span<typename ET::index_type const>>;
+        { eng.row_indices()    } -> same_as<std::span<typename ET::index_type const>>;
+        { eng.values()         } -> same_as<std::span<typename ET::element_type const>>;
+    };
+
+template<class ET>
+concept compressed_matrix_engine = csr_matrix_engine<ET> or csc_matrix_engine<ET>;
+
+template<class ET>
+concept sell_matrix_engine =
+    readable_matrix_engine<ET>
+    and
+    requires (ET const& eng)
+    {
+        typename ET::index_type;
+        requires (ET::slice_height > 0);
+        { eng.nonzeros()        } -> same_as<typename ET::size_type>;
+        { eng.slice_offsets()   } -> same_as<std::span<typename ET::index_type const>>;
+        { eng.row_lengths()     } -> same_as<std::span<typename ET::index_type const>>;
+        { eng.row_permutation() } -> same_as<std::span<typename ET::index_type const>>;
+        { eng.column_indices()  } -> same_as<std::span<typename ET::index_type const>>;
+        { eng.values()          } -> same_as<std::span<typename ET::element_type const>>;
+    };
+
+template<class ETR, class ET1, class ET2>
+concept sparse_product_engines =
+    dense_matrix_engine<ETR>
+    and
+    (compressed_matrix_engine<ET1> or sell_matrix_engine<ET1>)
+    and
+    dense_matrix_engine<ET2>
+    and
+    gemm_element<typename ETR::element_type>
+    and
+    same_as<typename ETR::element_type, typename ET1::element_type>
+    and
+    same_as<typename ETR::element_type, typename ET2::element_type>;
+
+
+//--------------------------------------------------------------------------------------------------
+//  Class Template:     csr_operand<T, IT>
+//
+//  This private type describes a sparse matrix in compressed sparse row form by its extents and
+//  pointers to its three arrays, so that it may be passed to the sparse kernels independent of
+//  engine type.  The arrays of a matrix in compressed sparse column form are those of its
+//  transpose in compressed sparse row form, and so it is described as its transpose.
+//--------------------------------------------------------------------------------------------------
+//
+template<class T, class IT>
+struct csr_operand
+{
+    size_t      rows;
+    size_t      cols;
+    IT const*   offsets;
+    IT const*   indices;
+    T const*    values;
+
+    constexpr size_t
+    row_begin(size_t i) const noexcept
+    {
+        return static_cast<size_t>(offsets[i]);
+    }
+
+    constexpr size_t
+    row_end(size_t i) const noexcept
+    {
+        return static_cast<size_t>(offsets[i + 1]);
+    }
+};
+
+//------
+//
+template<class ET> requires csr_matrix_engine<ET>
+constexpr auto
+make_csr_operand(ET const& eng) noexcept
+{
+    using elem_type  = typename ET::element_type;
+    using index_type = typename ET::index_type;
+
+    return csr_operand<elem_type, index_type>{static_cast<size_t>(eng.rows()),
+                                              static_cast<size_t>(eng.columns()),
+                                              eng.row_offsets().data(),
+                                              eng.column_indices().data(),
+                                              eng.values().data()};
+}
+
+template<class ET> requires csc_matrix_engine<ET>
+constexpr auto
+make_csr_operand(ET const& eng) noexcept
+{
+    using elem_type  = typename ET::element_type;
+    using index_type = typename ET::index_type;
+
+    return csr_operand<elem_type, index_type>{static_cast<size_t>(eng.columns()),
+                                              static_cast<size_t>(eng.rows()),
+                                              eng.column_offsets().data(),
+                                              eng.row_indices().data(),
+                                              eng.values().data()};
+}
+
+
+//--------------------------------------------------------------------------------------------------
+//  Class Template:     sell_operand<T, IT>
+//
+//  This private type describes a sparse matrix in sliced ELLPACK form by its extents and
+//  pointers to its five arrays, in the manner of csr_operand.  The slice height is not part of
+//  the description; it is a template parameter of the kernels that use it.
+//--------------------------------------------------------------------------------------------------
+//
+template<class T, class IT>
+struct sell_operand
+{
+    size_t      rows;
+    size_t      cols;
+    size_t      slices;
+    IT const*   offsets;
+    IT const*   lengths;
+    IT const*   permutation;
+    IT const*   indices;
+    T const*    values;
+
+    constexpr size_t
+    slice_begin(size_t s) const noexcept
+    {
+        return static_cast<size_t>(offsets[s]);
+    }
+
+    constexpr size_t
+    slice_end(size_t s) const noexcept
+    {
+        return static_cast<size_t>(offsets[s + 1]);
+    }
+};
+
+//------
+//
+template<class ET> requires sell_matrix_engine<ET>
+constexpr auto
+make_sell_operand(ET const& eng) noexcept
+{
+    using elem_type  = typename ET::element_type;
+    using index_type = typename ET::index_type;
+
+    return sell_operand<elem_type, index_type>{static_cast<size_t>(eng.rows()),
+                                               static_cast<size_t>(eng.columns()),
+                                               eng.slice_offsets().size() - 1,
+                                               eng.slice_offsets().data(),
+                                               eng.row_lengths().data(),
+                                               eng.row_permutation().data(),
+                                               eng.column_indices().data(),
+                                               eng.values().data()};
+}
+
+
+//--------------------------------------------------------------------------------------------------
+//  Class Template:     sell_slice_kernel<T, IT, C>
+//  Class Template:     simd_sell_slice_kernel<T, IT, C>
+//
+//  These private types describe the kernel that computes the products of a range of slices of
+//  a matrix in sliced ELLPACK form, of slice height C, with a unit-stride vector x, writing each
+//  to the element of a strided vector y given by the row permutation; and select a SIMD version
+//  of it suited to the host CPU.  The primary template of simd_sell_slice_kernel<T, IT, C>
+//  returns the portable kernel it is given; its specializations are in simd_support.hpp.
+//--------------------------------------------------------------------------------------------------
+//
+template<class T, class IT, size_t C>
+struct sell_slice_kernel
+{
+    using slice_function = void (*)(sell_operand<T, IT> const& a, size_t s0, size_t s1,
+                                    T const* x, T* y, size_t incy);
+
+    slice_function  multiply;
+};
+
+//------
+//
+template<class T, class IT, size_t C>
+struct simd_sell_slice_kernel
+{
+    static sell_slice_kernel<T, IT, C>
+    select(sell_slice_kernel<T, IT, C> const& fallback) noexcept
+    {
+        return fallback;
+    }
+};
+
+
+//--------------------------------------------------------------------------------------------------
+//  Class Template:     sparse_kernel<T, IT>
+//
+//  This private type implements products of a sparse matrix A in compressed sparse row form and
+//  a dense vector (SpMV) or a dense matrix (SpMM).  Each row of A is a list of (column, value)
+//  pairs, so only its non-zero elements are visited.
+//
+//  For y = A*x, each element of y is a sparse dot product of a row of A with x, which gathers
+//  the elements of x at the row's column indices.  It keeps four partial sums, as does the dense
+//  dot product, so that consecutive multiply-adds do not depend on one another, and the loads
+//  from x may be issued as vector gathers.  For C = A*B with row-major B and C, row i of C is
+//  the sum of the rows of B selected by the column indices of row i of A, each scaled by the
+//  corresponding element; these are unit-stride AXPY updates, computed by the SIMD vector
+//  kernels.  Other layouts are computed one column of B at a time, as matrix-vector products.
+//
+//  Products with the transpose of A, which are those of a matrix in compressed sparse column
+//  form, scatter instead: row i of A is added into the elements (or rows) of the result selected
+//  by its column indices, scaled by element i of x (or row i of B).
+//--------------------------------------------------------------------------------------------------
+//
+template<class T, class IT>
+struct sparse_kernel
+{
+    using sparse_type  = csr_operand<T, IT>;
+    using operand_type = dense_operand<T const>;
+    using result_type  = dense_operand<T>;
+
+    //- Compute the dot product of row i of A with x, whose elements may be strided.
+    //
+    static T
+    row_dot(sparse_type const& a, size_t i, T const* x, size_t incx)
+    {
+        return range_dot(a, a.row_begin(i), a.row_end(i), x, incx);
+    }
+
+    //- Compute the dot product of the elements [first, last) of a row of A with x.
+    //
+    static T
+    range_dot(sparse_type const& a, size_t first, size_t last, T const* x, size_t incx)
+    {
+        IT const* const     idx = a.indices;
+        T const* const      val = a.values;
+
+        T       s0{}, s1{}, s2{}, s3{};
+        size_t  k = first;
+
+        if (incx == 1)
+        {
+            for (;  k + 4 <= last;  k += 4)
+            {
+                s0 = s0 + val[k]   * x[static_cast<size_t>(idx[k])];
+                s1 = s1 + val[k+1] * x[static_cast<size_t>(idx[k+1])];
+                s2 = s2 + val[k+2] * x[static_cast<size_t>(idx[k+2])];
+                s3 = s3 + val[k+3] * x[static_cast<size_t>(idx[k+3])];
+            }
+        }
+        for (;  k < last;  ++k)
+        {
+            s0 = s0 + val[k] * x[static_cast<size_t>(idx[k]) * incx];
+        }
+        return (s0 + s1) + (s2 + s3);
+    }
+
+    //- Compute y = A*x, where y has A.rows elements and x has A.cols elements.
+    //
+    static void
+    multiply(sparse_type const& a, T const* x, size_t incx, T* y, size_t incy)
+    {
+        for (size_t i = 0;  i < a.rows;  ++i)
+        {
+            y[i*incy] = row_dot(a, i, x, incx);
+        }
+    }
+
+    //- Compute C = A*B, where B has A.cols rows, and C has A.rows rows and as many columns as B.
+    //
+    static void
+    multiply(sparse_type const& a, operand_type b, result_type c)
+    {
+        if (has_row_operands(b, c))
+        {
+            multiply_rows(a, b, c, 0, a.rows);
+        }
+        else
+        {
+            for (size_t j = 0;  j < c.cols;  ++j)
+            {
+                multiply(a, &b(0, j), b.row_stride, &c(0, j), c.row_stride);
+            }
+        }
+    }
+
+    //- Determine whether C = A*B may be computed by rows, as AXPY updates.
+    //
+    static bool
+    has_row_operands(operand_type b, result_type c) noexcept
+    {
+        return b.col_stride == 1  &&  c.col_stride == 1  &&  b.cols > 1;
+    }
+
+    //- Compute the rows [i0, i1) of C = A*B, where the rows of B and C are contiguous.
+    //
+    static void
+    multiply_rows(sparse_type const& a, operand_type b, result_type c, size_t i0, size_t i1)
+    {
+        auto const  axpy = gemv_kernel<T>::select_kernels().axpy;
+
+        for (size_t i = i0;  i < i1;  ++i)
+        {
+            T* const    ci = &c(i, 0);
+
+            std::fill_n(ci, c.cols, T{});
+
+            for (size_t k = a.row_begin(i);  k < a.row_end(i);  ++k)
+            {
+                axpy(c.cols, a.values[k], &b(static_cast<size_t>(a.indices[k]), 0), ci);
+            }
+        }
+    }
+
+    //- Compute y = A^T*x, where y has A.cols elements and x has A.rows elements.
+    //
+    static void
+    multiply_transpose(sparse_type const& a, T const* x, size_t incx, T* y, size_t incy)
+    {
+        IT const* const     idx = a.indices;
+        T const* const      val = a.values;
+
+        for (size_t j = 0;  j < a.cols;  ++j)
+        {
+            y[j*incy] = T{};
+        }
+        for (size_t i = 0;  i < a.rows;  ++i)
+        {
+            T const     xi = x[i*incx];
+
+            for (size_t k = a.row_begin(i);  k < a.row_end(i);  ++k)
+            {
+                T&  yj = y[static_cast<size_t>(idx[k]) * incy];
+
+                yj = yj + val[k] * xi;
+            }
+        }
+    }
+
+    //- Compute C = A^T*B, where B has A.rows rows, and C has A.cols rows and as many columns as B.
+    //
+    static void
+    multiply_transpose(sparse_type const& a, operand_type b, result_type c)
+    {
+        if (has_row_operands(b, c))
+        {
+            auto const  axpy = gemv_kernel<T>::select_kernels().axpy;
+
+            for (size_t j = 0;  j < c.rows;  ++j)
+            {
+                std::fill_n(&c(j, 0), c.cols, T{});
+            }
+            for (size_t i = 0;  i < a.rows;  ++i)
+            {
+                T const* const  bi = &b(i, 0);
+
+                for (size_t k = a.row_begin(i);  k < a.row_end(i);  ++k)
+                {
+                    axpy(c.cols, a.values[k], bi, &c(static_cast<size_t>(a.indices[k]), 0));
+                }
+            }
+        }
+        else
+        {
+            for (size_t j = 0;  j < c.cols;  ++j)
+            {
+                multiply_transpose(a, &b(0, j), b.row_stride, &c(0, j), c.row_stride);
+            }
+        }
+    }
+};
+
+
+//==================================================================================================
+//  TYPES AND TRAITS DEFINITIONS -- BATCHED GEMM
+//==================================================================================================
+//--------------------------------------------------------------------------------------------------
+//  Class:      batch_executor
+//
+//  This private type computes a batch of independent operations in parallel.  The batch is
+//  divided into contiguous runs, one per thread, so that no operation is shared between threads
+//  and each thread reuses its own workspace; the runs are executed by parallel_runner.  The
+//  member `min_thread_work` is the least number of multiply-adds assigned to each thread, as for
+//  gemm_kernel<T>::parallel_multiply().
+//--------------------------------------------------------------------------------------------------
+//
+struct batch_executor
+{
+    static constexpr size_t     min_thread_work = 64u * 64u * 64u;
+
+    //- Invoke FN(p) for each p in [0, count), using at most max_threads threads, where each
+    //  invocation performs about item_work multiply-adds.  The calling thread takes the first
+    //  run of the batch.
+    //
+    template<class FN>
+    static void
+    for_each(size_t count, size_t item_work, FN&& fn, size_t max_threads)
+    {
+        size_t const    total   = count * std::max<size_t>(item_work, 1);
+        size_t const    threads = std::min({max_threads, total / min_thread_work, count});
+
+        if (threads <= 1)
+        {
+            for (size_t p = 0;  p < count;  ++p)
+            {
+                fn(p);
+            }
+            return;
+        }
+
+        parallel_runner::run(threads, [&](size_t t)
+        {
+            size_t const    p0 = t * count / threads;
+            size_t const    p1 = (t + 1) * count / threads;
+
+            for (size_t p = p0;  p < p1;  ++p)
+            {
+                fn(p);
+            }
+        });
+    }
+};
+
+
+//--------------------------------------------------------------------------------------------------
+//  Class Template:     batched_gemm_kernel<T>
+//
+//  This private type computes the products C[p] = alpha*A[p]*B[p] + beta*C[p] of a batch of
+//  dense operands, each of which is usually small.
+//
+//  Products of fewer than `max_direct_work` multiply-adds whose rows of B and C are contiguous
+//  are computed directly, one row of C at a time, as a sum of rows of B scaled by the elements
+//  of A, using the AXPY vector kernel; for such small products, this is faster than packing.
+//  Larger products are computed by the packed kernel.
+//--------------------------------------------------------------------------------------------------
+//
+template<class T>
+struct batched_gemm_kernel
+{
+    using operand_type    = dense_operand<T const>;
+    using result_type     = dense_operand<T>;
+    using blocking_traits = gemm_blocking_traits<T>;
+
+    static constexpr size_t     max_direct_work = 32u * 32u * 32u;
+
+    //- Compute C = alpha*A*B + beta*C for a single product of the batch.
+    //
+    static void
+    multiply(T const& alpha, operand_type a, operand_type b, T const& beta, result_type c)
+    {
+        size_t const    work = c.rows * c.cols * a.cols;
+
+        if (b.col_stride == 1  &&  c.col_stride == 1  &&  work < max_direct_work)
+        {
+            auto const  axpy = gemv_kernel<T>::select_kernels().axpy;
+
+            for (size_t i = 0;  i < c.rows;  ++i)
+            {
+                T* const    pc = &c(i, 0);
+
+                if (beta == T{})
+                {
+                    std::fill_n(pc, c.cols, T{});
+                }
+                else if (beta != T{1})
+                {
+                    for (size_t j = 0;  j < c.cols;  ++j)
+                    {
+                        pc[j] = beta * pc[j];
+                    }
+                }
+
+                for (size_t k = 0;  k < a.cols;  ++k)
+                {
+                    axpy(c.cols, alpha * a(i, k), &b(k, 0), pc);
+                }
+            }
+        }
+        else if (work >= blocking_traits::min_work  &&  c.rows > 1  &&  c.cols > 1)
+        {
+            gemm_kernel<T>::multiply(alpha, a, b, beta, c);
+        }
+        else
+        {
+            for (size_t i = 0;  i < c.rows;  ++i)
+            {
+                for (size_t j = 0;  j < c.cols;  ++j)
+                {
+                    T   s{};
+
+                    for (size_t k = 0;  k < a.cols;  ++k)
+                    {
+                        s = s + a(i, k) * b(k, j);
+                    }
+                    c(i, j) = (beta == T{}) ? alpha * s : alpha * s + beta * c(i, j);
+                }
+            }
+        }
+    }
+};
+
+
+//==================================================================================================
+//  TYPES AND TRAITS DEFINITIONS -- FIXED-SIZE KERNELS
+//==================================================================================================
+//--------------------------------------------------------------------------------------------------
+//  Concept:    small_fixed_size_engine<ET>
+//
+//  This private concept determines whether an engine type has extents that are known at compile
+//  time, and small enough (no more than 8 x 8) that arithmetic on it should be fully unrolled.
+//--------------------------------------------------------------------------------------------------
+//
+inline constexpr size_t     max_unrolled_extent = 8;
+
+template<class ET>
+concept small_fixed_size_engine =
+    readable_matrix_engine<ET>
+    and
+    (engine_extents_helper<ET>::rows() != std::dynamic_extent)
+    and
+    (engine_extents_helper<ET>::columns() != std::dynamic_extent)
+    and
+    (engine_extents_helper<ET>::rows() <= max_unrolled_extent)
+    and
+    (engine_extents_helper<ET>::columns() <= max_unrolled_extent);
+
+
+//--------------------------------------------------------------------------------------------------
+//  Concept:    contiguous_row_major_engine<ET, R, C>
+//
+//  This private concept determines whether an engine type stores R x C elements contiguously,
+//  in row-major order, so that each row may be loaded directly into a SIMD register.
+//--------------------------------------------------------------------------------------------------
+//
+template<class ET, size_t R, size_t C>
+concept contiguous_row_major_engine =
+    dense_matrix_engine<ET>
+    and
+    same_as<typename ET::const_mdspan_type::layout_type, MDSPAN_NS::layout_right>
+    and
+    (ET::const_mdspan_type::extents_type::static_extent(0) == R)
+    and
+    (ET::const_mdspan_type::extents_type::static_extent(1) == C);
+
+
+//--------------------------------------------------------------------------------------------------
+//  Class Template:     simd_row_ops<T, N>
+//
+//  This private traits type describes a SIMD register holding exactly N elements of type T that
+//  is available at compile time.  The primary template indicates that there is none; the
+//  specializations that exist are in simd_support.hpp.
+//--------------------------------------------------------------------------------------------------
+//
+template<class T, size_t N>
+struct simd_row_ops
+{
+    static constexpr bool   available = false;
+};
+
+
+//--------------------------------------------------------------------------------------------------
+//  Function Template:  accumulator_product<AT, T>(e1, e2)
+//
+//  Forms the product of two elements as a term of a sum of elements of type T that is to be
+//  accumulated in type AT.  If AT is T, the product is formed exactly as by operator*, so that
+//  the default accumulator type leaves every result unchanged; otherwise, the operands are
+//  converted to AT first.
+//--------------------------------------------------------------------------------------------------
+//
+template<class AT, class T, class T1, class T2>
+constexpr auto
+accumulator_product(T1 const& e1, T2 const& e2)
+{
+    if constexpr (same_as<AT, T>)
+    {
+        return e1 * e2;
+    }
+    else
+    {
+        return static_cast<AT>(e1) * static_cast<AT>(e2);
+    }
+}
+
+
+//--------------------------------------------------------------------------------------------------
+//  Class Template:     fixed_size_kernel<R, C>
+//
+//  This private type implements element-wise arithmetic and multiplication for results having
+//  R rows and C columns, where both are small compile-time constants.  Every loop is unrolled
+//  at compile time through std::index_sequence.  Element-wise results are computed exactly as
+//  in the loops of the arithmetic traits, and so do not depend on which is used.
+//
+//  Products of row-major, contiguous operands whose rows fit a SIMD register are computed row
+//  by row as a sum of broadcast elements of A times rows of B, when not constant-evaluated.
+//  The terms are summed in the same order as by the loops, but where the compiler has been
+//  told it may use FMA instructions, each multiply-add is rounded once rather than twice, and
+//  so these products may differ in their last bits from those computed by the loops, or at
+//  compile time.
+//--------------------------------------------------------------------------------------------------
+//
+template<size_t R, size_t C>
+struct fixed_size_kernel
+{
+    template<class MR, class M1, class M2>
+    static constexpr void
+    add(MR& mr, M1 const& m1, M2 const& m2)
+    {
+        [&]<size_t... I>(std::index_sequence<I...>)
+        {
+            ((mr(I / C, I % C) = m1(I / C, I % C) + m2(I / C, I % C)), ...);
+        }(std::make_index_sequence<R*C>{});
+    }
+
+    template<class MR, class M1, class M2>
+    static constexpr void
+    subtract(MR& mr, M1 const& m1, M2 const& m2)
+    {
+        [&]<size_t... I>(std::index_sequence<I...>)
+        {
+            ((mr(I / C, I % C) = m1(I / C, I % C) - m2(I / C, I % C)), ...);
+        }(std::make_index_sequence<R*C>{});
+    }
+
+    template<class MR, class S1, class M2>
+    static constexpr void
+    multiply_scalar_left(MR& mr, S1 const& s1, M2 const& m2)
+    {
+        [&]<size_t... I>(std::index_sequence<I...>)
+        {
+            ((mr(I / C, I % C) = s1 * m2(I / C, I % C)), ...);
+        }(std::make_index_sequence<R*C>{});
+    }
+
+    template<class MR, class M1, class S2>
+    static constexpr void
+    multiply_scalar_right(MR& mr, M1 const& m1, S2 const& s2)
+    {
+        [&]<size_t... I>(std::index_sequence<I...>)
+        {
+            ((mr(I / C, I % C) = m1(I / C, I % C) * s2), ...);
+        }(std::make_index_sequence<R*C>{});
+    }
+
+    template<class MR, class M1, class S2>
+    static constexpr void
+    divide_scalar(MR& mr, M1 const& m1, S2 const& s2)
+    {
+        [&]<size_t... I>(std::index_sequence<I...>)
+        {
+            ((mr(I / C, I % C) = m1(I / C, I % C) / s2), ...);
+        }(std::make_index_sequence<R*C>{});
+    }
+
+    template<size_t K, class AT, class MR, class M1, class M2>
+    static constexpr void
+    multiply(MR& mr, M1 const& m1, M2 const& m2)
+    {
+        using element_type  = typename MR::element_type;
+        using engine_type_r = typename MR::engine_type;
+        using engine_type_1 = typename M1::engine_type;
+        using engine_type_2 = typename M2::engine_type;
+        using row_ops       = simd_row_ops<element_type, C>;
+
+        if constexpr (row_ops::available
+                      and same_as<AT, element_type>
+                      and contiguous_row_major_engine<engine_type_r, R, C>
+                      and contiguous_row_major_engine<engine_type_1, R, K>
+                      and contiguous_row_major_engine<engine_type_2, K, C>
+                      and same_as<element_type, typename M1::element_type>
+                      and same_as<element_type, typename M2::element_type>)
+        {
+            if (not std::is_constant_evaluated())
+            {
+                simd_multiply<K, row_ops>(mr.span().data_handle(),
+                                          m1.span().data_handle(),
+                                          m2.span().data_handle());
+                return;
+            }
+        }
+
+        [&]<size_t... I>(std::index_sequence<I...>)
+        {
+            (multiply_row<I, K, AT>(mr, m1, m2), ...);
+        }(std::make_index_sequence<R>{});
+    }
+
+  private:
+    //- Each row of the result is accumulated in i-k-j order, which allows the compiler to
+    //  vectorize across the row, and sums the terms of each element in the same order as the
+    //  i-j-k loop.  The sums are formed in the accumulator type AT.
+    //
+    template<size_t I, size_t K, class AT, class MR, class M1, class M2>
+    static constexpr void
+    multiply_row(MR& mr, M1 const& m1, M2 const& m2)
+    {
+        using element_type = typename MR::element_type;
+
+        AT      er[C] = {};
+
+        [&]<size_t... P>(std::index_sequence<P...>)
+        {
+            (multiply_row_term<I, P, element_type>(er, m1, m2), ...);
+        }(std::make_index_sequence<K>{});
+
+        [&]<size_t... J>(std::index_sequence<J...>)
+        {
+            ((mr(I, J) = static_cast<element_type>(er[J])), ...);
+        }(std::make_index_sequence<C>{});
+    }
+
+    template<size_t I, size_t P, class ET, class AT, class M1, class M2>
+    static constexpr void
+    multiply_row_term(AT (&er)[C], M1 const& m1, M2 const& m2)
+    {
+        auto const&     e1 = m1(I, P);
+
+        [&]<size_t... J>(std::index_sequence<J...>)
+        {
+            ((er[J] = er[J] + accumulator_product<AT, ET>(e1, m2(P, J))), ...);
+        }(std::make_index_sequence<C>{});
+    }
+
+    template<size_t K, class OPS, class T>
+    static void
+    simd_multiply(T* pr, T const* p1, T const* p2)
+    {
+        using vec = typename OPS::vec;
+
+        [&]<size_t... P>(std::index_sequence<P...>)
+        {
+            vec const   b[K] = { OPS::load(p2 + P*C)... };
+
+            for (size_t i = 0;  i < R;  ++i)
+            {
+                vec     acc = OPS::zero();
+
+                ((acc = OPS::fmadd(OPS::bcast(p1 + i*K + P), b[P], acc)), ...);
+                OPS::store(pr + i*C, acc);
+            }
+        }(std::make_index_sequence<K>{});
+    }
+};
+
+//------
+//
+template<class ET>
+using fixed_size_kernel_for = fixed_size_kernel<engine_extents_helper<ET>::rows(),
+                                                engine_extents_helper<ET>::columns()>;
+
+
+//==================================================================================================
+//  TYPES AND TRAITS DEFINITIONS -- SPARSE MATRIX PRODUCTS
+//==================================================================================================
+//--------------------------------------------------------------------------------------------------
+//  Class Template:     parallel_sparse_kernel<T, IT>
+//
+//  This private type computes the products of sparse_kernel<T, IT> in parallel, dividing the
+//  work among the threads by the number of non-zero elements, rather than by the number of rows,
+//  so that matrices whose rows vary greatly in length, such as those of power-law graphs, are
+//  computed in about equal parts by each thread.
+//
+//  For y = A*x, the work is divided by the merge-path method: the rows of A and its non-zero
+//  elements are consumed together as a single path of length rows + nonzeros, which is divided
+//  into equal parts, one per thread.  The start of each part is found by a binary search of the
+//  row offsets, so a part may begin and end within a row, and no single long row leaves the
+//  other threads idle.  Each thread writes the rows that end in its part, and the partial sum
+//  of the row at the end of its part is added afterward, by the calling thread.  Counting the
+//  rows as well as the elements balances the cost of writing y when many rows are short.
+//
+//  For C = A*B with contiguous rows of B and C, the rows of A are divided at the row offsets
+//  nearest to equal fractions of the non-zero elements, since each element is an AXPY update of
+//  a whole row of C; other layouts are computed one column at a time, as above.
+//
+//  The row offsets are already the prefix sum of the lengths of the rows, so each division costs
+//  one binary search per thread, and nothing is kept between products.
+//--------------------------------------------------------------------------------------------------
+//
+template<class T, class IT>
+struct parallel_sparse_kernel
+{
+    using kernel_type  = sparse_kernel<T, IT>;
+    using sparse_type  = typename kernel_type::sparse_type;
+    using operand_type = typename kernel_type::operand_type;
+    using result_type  = typename kernel_type::result_type;
+
+    //- Compute y = A*x, using up to max_threads threads.
+    //
+    static void
+    multiply(sparse_type const& a, T const* x, size_t incx, T* y, size_t incy, size_t max_threads)
+    {
+        size_t const    length = a.rows + a.row_begin(a.rows);
+        size_t const    parts  = std::clamp<size_t>(length / batch_executor::min_thread_work, 1, max_threads);
+
+        if (parts == 1)
+        {
+            kernel_type::multiply(a, x, incx, y, incy);
+            return;
+        }
+
+        std::vector<size_t>     carry_rows(parts);
+        std::vector<T>          carry_sums(parts);
+
+        batch_executor::for_each(parts, length / parts, [&](size_t t)
+        {
+            auto const  [i0, k0] = merge_path_search(a, t * length / parts);
+            auto const  [i1, k1] = merge_path_search(a, (t + 1) * length / parts);
+            size_t      k        = k0;
+
+            for (size_t i = i0;  i < i1;  ++i)
+            {
+                y[i*incy] = kernel_type::range_dot(a, k, a.row_end(i), x, incx);
+                k = a.row_end(i);
+            }
+            carry_rows[t] = i1;
+            carry_sums[t] = kernel_type::range_dot(a, k, k1, x, incx);
+        },
+        max_threads);
+
+        for (size_t t = 0;  t < parts;  ++t)
+        {
+            if (carry_rows[t] < a.rows)
+            {
+                y[carry_rows[t]*incy] = y[carry_rows[t]*incy] + carry_sums[t];
+            }
+        }
+    }
+
+    //- Compute C = A*B, using up to max_threads threads.
+    //
+    static void
+    multiply(sparse_type const& a, operand_type b, result_type c, size_t max_threads)
+    {
+        if (kernel_type::has_row_operands(b, c))
+        {
+            size_t const    nnz   = a.row_begin(a.rows);
+            size_t const    parts = std::clamp<size_t>(nnz * c.cols / batch_executor::min_thread_work,
+                                                       1, max_threads);
+
+            batch_executor::for_each(parts, nnz * c.cols / parts, [&](size_t t)
+            {
+                kernel_type::multiply_rows(a, b, c, row_at(a, t * nnz / parts),
+                                           (t + 1 == parts) ? a.rows : row_at(a, (t + 1) * nnz / parts));
+            },
+            max_threads);
+        }
+        else
+        {
+            for (size_t j = 0;  j < c.cols;  ++j)
+            {
+                multiply(a, &b(0, j), b.row_stride, &c(0, j), c.row_stride, max_threads);
+            }
+        }
+    }
+
+  private:
+    struct path_point
+    {
+        size_t  row;
+        size_t  nz;
+    };
+
+    //- Find the point at which the given diagonal crosses the merge path; i.e., the number of
+    //  rows ended and of elements consumed after `diagonal` steps along the path.
+    //
+    static path_point
+    merge_path_search(sparse_type const& a, size_t diagonal) noexcept
+    {
+        size_t const    nnz = a.row_begin(a.rows);
+        size_t          lo  = (diagonal > nnz) ? diagonal - nnz : 0;
+        size_t          hi  = std::min(diagonal, a.rows);
+
+        while (lo < hi)
+        {
+            size_t const    pivot = lo + (hi - lo) / 2;
+
+            if (a.row_end(pivot) <= diagonal - pivot - 1)
+            {
+                lo = pivot + 1;
+            }
+            else
+            {
+                hi = pivot;
+            }
+        }
+        return path_point{lo, diagonal - lo};
+    }
+
+    //- Find the first row beginning at or after the element nz.
+    //
+    static size_t
+    row_at(sparse_type const& a, size_t nz) noexcept
+    {
+        IT const* const     first = a.offsets;
+        IT const* const     pos   = std::lower_bound(first, first + a.rows, static_cast<IT>(nz));
+
+        return static_cast<size_t>(pos - first);
+    }
+};
+
+
+//--------------------------------------------------------------------------------------------------
+//  Class Template:     spgemm_kernel<T, AT, IT>
+//
+//  This private type computes the product C = A*B of two sparse matrices in compressed sparse
+//  row form, giving C in the same form, with elements of type T accumulated in type AT, and
+//  indices of type IT.  It uses Gustavson's method: row i of C is the sum of the rows of B
+//  selected by the column indices of row i of A, each scaled by the corresponding element.
+//
+//  A symbolic pass first computes, for each row of C, an upper bound on its number of elements:
+//  the total number of elements of the rows of B that contribute to it.  This bounds both the
+//  work of the row and its storage, so that the rows are divided among the threads in chunks
+//  of about equal work, and each row is written to a temporary region of its bounded size,
+//  without the threads having to coordinate.  Each thread accumulates its rows in a sparse
+//  accumulator of its own, chosen per row by its bound:
+//
+//      - a dense accumulator, indexed by column, with a marker per column, for rows whose bound
+//        is a large fraction of the columns of C, where hashing would only add cost;
+//      - otherwise, an open-addressing hash table of twice the bound, which is small enough to
+//        stay in cache whatever the number of columns.
+//
+//  The columns of each row are then sorted, and once the exact number of elements of every row
+//  is known, the rows are compacted into the arrays of C in parallel.
+//
+//  A matrix in compressed sparse column form is described as the transpose of one in compressed
+//  sparse row form, by csr_operand; transpose() converts between the two forms when the two
+//  operands of a product have different forms.
+//
+//  The division of the rows among the threads, and the structure of any such transpose, are
+//  recorded in a sparse_product_pattern, with which multiply_values() recomputes the values of
+//  a product of the same pattern: the columns of each row of C are already known, and so each
+//  row is summed in a dense accumulator and written in place, with no bounds, sorting or
+//  temporary regions.
+//--------------------------------------------------------------------------------------------------
+//
+template<class T, class AT, class IT>
+struct spgemm_kernel
+{
+    //- Rows whose bound is at least this fraction of the columns of C use a dense accumulator.
+    //
+    static constexpr size_t     dense_row_ratio = 16;
+
+    //- The product of the sparse engines E1 and E2, in the compressed form of E1, recording its
+    //  symbolic phase in pattern.
+    //
+    template<class ET1, class ET2, class IAT, class VAT>
+    static void
+    multiply(ET1 const& e1, ET2 const& e2, sparse_product_pattern& pattern,
+             std::vector<IT, IAT>& offsets, std::vector<IT, IAT>& indices, std::vector<T, VAT>& values,
+             size_t max_threads)
+    {
+        auto const  a = make_csr_operand(e1);
+        auto const  b = make_csr_operand(e2);
+
+        pattern.m_rows       = static_cast<size_t>(e1.rows());
+        pattern.m_cols       = static_cast<size_t>(e2.columns());
+        pattern.m_inner      = static_cast<size_t>(e1.columns());
+        pattern.m_nnz_a      = static_cast<size_t>(e1.nonzeros());
+        pattern.m_nnz_b      = static_cast<size_t>(e2.nonzeros());
+        pattern.m_row_major  = csr_matrix_engine<ET1>;
+        pattern.m_transposed = (csr_matrix_engine<ET1> != csr_matrix_engine<ET2>);
+
+        //- For CSR, C = A*B; for CSC, the operands describe the transposes, and C^T = B^T * A^T.
+        //
+        if constexpr (csr_matrix_engine<ET1> == csr_matrix_engine<ET2>)
+        {
+            pattern.m_offsets.clear();
+            pattern.m_indices.clear();
+            pattern.m_perm.clear();
+
+            if constexpr (csr_matrix_engine<ET1>)
+            {
+                multiply_rows(a, b, pattern.m_first_rows, offsets, indices, values, max_threads);
+            }
+            else
+            {
+                multiply_rows(b, a, pattern.m_first_rows, offsets, indices, values, max_threads);
+            }
+        }
+        else
+        {
+            //- The transpose is built with size_t indices, since its column indices count the
+            //  major extent of the second operand, which its own index type need not represent.
+            //
+            transpose(b, pattern.m_offsets, pattern.m_indices, pattern.m_perm);
+
+            auto const  b_values = transposed_values(b, pattern.m_perm);
+            auto const  bt       = transposed_operand(b, pattern, b_values.data());
+
+            if constexpr (csr_matrix_engine<ET1>)
+            {
+                multiply_rows(a, bt, pattern.m_first_rows, offsets, indices, values, max_threads);
+            }
+            else
+            {
+                multiply_rows(bt, a, pattern.m_first_rows, offsets, indices, values, max_threads);
+            }
+        }
+
+        pattern.m_nnz = values.size();
+    }
+
+    //- Recompute the values of C, the product of the sparse engines E1 and E2, whose symbolic
+    //  phase was recorded in pattern.  The operands must have the same sparsity patterns as
+    //  those from which it was recorded; their extents, forms and numbers of elements are
+    //  checked, as is that every product term falls within the pattern of C.
+    //
+    template<class ET1, class ET2, class ETR>
+    static void
+    multiply_values(ET1 const& e1, ET2 const& e2, sparse_product_pattern const& pattern, ETR& c,
+                    size_t max_threads)
+    {
+        bool const  valid = (pattern.m_rows  == static_cast<size_t>(e1.rows()))
+                         && (pattern.m_cols  == static_cast<size_t>(e2.columns()))
+                         && (pattern.m_inner == static_cast<size_t>(e1.columns()))
+                         && (pattern.m_inner == static_cast<size_t>(e2.rows()))
+                         && (pattern.m_nnz_a == static_cast<size_t>(e1.nonzeros()))
+                         && (pattern.m_nnz_b == static_cast<size_t>(e2.nonzeros()))
+                         && (pattern.m_nnz   == static_cast<size_t>(c.nonzeros()))
+                         && (pattern.m_rows  == static_cast<size_t>(c.rows()))
+                         && (pattern.m_cols  == static_cast<size_t>(c.columns()))
+                         && (pattern.m_row_major  == csr_matrix_engine<ET1>)
+                         && (pattern.m_transposed == (csr_matrix_engine<ET1> != csr_matrix_engine<ET2>))
+                         && (csr_matrix_engine<ETR> == csr_matrix_engine<ET1>)
+                         && (pattern.m_first_rows.size() > 1);
+
+        if (not valid)
+        {
+            throw runtime_error("sparse product operands do not match its pattern");
+        }
+
+        auto const  a  = make_csr_operand(e1);
+        auto const  b  = make_csr_operand(e2);
+        auto const  cr = make_csr_operand(c);
+        T* const    pc = c.values().data();
+
+        if constexpr (csr_matrix_engine<ET1> == csr_matrix_engine<ET2>)
+        {
+            if constexpr (csr_matrix_engine<ET1>)
+            {
+                multiply_row_values(a, b, pattern.m_first_rows, cr, pc, max_threads);
+            }
+            else
+            {
+                multiply_row_values(b, a, pattern.m_first_rows, cr, pc, max_threads);
+            }
+        }
+        else
+        {
+            auto const  b_values = transposed_values(b, pattern.m_perm);
+            auto const  bt       = transposed_operand(b, pattern, b_values.data());
+
+            if constexpr (csr_matrix_engine<ET1>)
+            {
+                multiply_row_values(a, bt, pattern.m_first_rows, cr, pc, max_threads);
+            }
+            else
+            {
+                multiply_row_values(bt, a, pattern.m_first_rows, cr, pc, max_threads);
+            }
+        }
+    }
+
+    //- Convert the structure of A, which has A.rows rows, into that of its transpose, whose
+    //  indices are of type IT2, and find the position in A of each element of the transpose.
+    //  The row numbers of A become column indices, and so IT2 must represent A.rows, which IT1
+    //  need not; e.g., for an operand in compressed sparse column form, whose index type is
+    //  checked only against its number of rows.
+    //
+    template<class T1, class IT1, class IT2, class IAT>
+    static void
+    transpose(csr_operand<T1, IT1> const& a, std::vector<IT2, IAT>& offsets,
+              std::vector<IT2, IAT>& indices, std::vector<size_t>& perm)
+    {
+        size_t const    nnz = a.row_begin(a.rows);
+
+        offsets.assign(a.cols + 1, IT2{0});
+        indices.resize(nnz);
+        perm.resize(nnz);
+
+        for (size_t k = 0;  k < nnz;  ++k)
+        {
+            ++offsets[static_cast<size_t>(a.indices[k]) + 1];
+        }
+        for (size_t j = 0;  j < a.cols;  ++j)
+        {
+            offsets[j + 1] += offsets[j];
+        }
+
+        std::vector<size_t>     next(offsets.begin(), offsets.end() - 1);
+
+        for (size_t i = 0;  i < a.rows;  ++i)
+        {
+            for (size_t k = a.row_begin(i);  k < a.row_end(i);  ++k)
+            {
+                size_t const    dst = next[static_cast<size_t>(a.indices[k])]++;
+
+                indices[dst] = static_cast<IT2>(i);
+                perm[dst]    = k;
+            }
+        }
+    }
+
+  private:
+    //- The values of the transpose of A, in the order given by perm.
+    //
+    template<class T1, class IT1>
+    static std::vector<T1>
+    transposed_values(csr_operand<T1, IT1> const& a, std::vector<size_t> const& perm)
+    {
+        std::vector<T1>     values(perm.size());
+
+        for (size_t k = 0;  k < perm.size();  ++k)
+        {
+            values[k] = a.values[perm[k]];
+        }
+        return values;
+    }
+
+    //- The transpose of A, whose structure is held by pattern.
+    //
+    template<class T1, class IT1>
+    static csr_operand<T1, size_t>
+    transposed_operand(csr_operand<T1, IT1> const& a, sparse_product_pattern const& pattern,
+                       T1 const* values) noexcept
+    {
+        return csr_operand<T1, size_t>{a.cols, a.rows, pattern.m_offsets.data(),
+                                       pattern.m_indices.data(), values};
+    }
+
+    //- The product of A and B, which has A.rows rows and B.cols columns; the first row of each
+    //  thread's chunk is written to first_rows.
+    //
+    template<class T1, class IT1, class T2, class IT2, class IAT, class VAT>
+    static void
+    multiply_rows(csr_operand<T1, IT1> const& a, csr_operand<T2, IT2> const& b,
+                  std::vector<size_t>& first_rows, std::vector<IT, IAT>& offsets,
+                  std::vector<IT, IAT>& indices, std::vector<T, VAT>& values, size_t max_threads)
+    {
+        size_t const    rows = a.rows;
+        size_t const    cols = b.cols;
+
+        //- The symbolic pass; the bound of row i is bounds[i+1] - bounds[i].
+        //
+        std::vector<size_t>     bounds(rows + 1, 0);
+
+        for (size_t i = 0;  i < rows;  ++i)
+        {
+            size_t  ub = 0;
+
+            for (size_t k = a.row_begin(i);  k < a.row_end(i);  ++k)
+            {
+                size_t const    j = static_cast<size_t>(a.indices[k]);
+
+                ub += b.row_end(j) - b.row_begin(j);
+            }
+            bounds[i + 1] = bounds[i] + ub;
+        }
+
+        size_t const    total  = bounds[rows];
+        size_t const    chunks = std::clamp<size_t>(total / batch_executor::min_thread_work, 1, max_threads);
+
+        //- Divide the rows into chunks of about equal work.
+        //
+        first_rows.assign(chunks + 1, rows);
+
+        for (size_t c = 0;  c < chunks;  ++c)
+        {
+            size_t const    target = c * total / chunks;
+
+            first_rows[c] = static_cast<size_t>(std::lower_bound(bounds.begin(), bounds.end() - 1, target)
+                                                - bounds.begin());
+        }
+        first_rows[0] = 0;
+
+        //- The numeric pass, into the temporary regions.
+        //
+        std::vector<IT>         tmp_indices(total);
+        std::vector<T>          tmp_values(total);
+        std::vector<size_t>     counts(rows + 1, 0);
+
+        batch_executor::for_each(chunks, total / chunks, [&](size_t c)
+        {
+            row_accumulator     acc(cols);
+
+            for (size_t i = first_rows[c];  i < first_rows[c + 1];  ++i)
+            {
+                counts[i + 1] = acc.compute_row(a, b, i, bounds[i + 1] - bounds[i],
+                                                tmp_indices.data() + bounds[i], tmp_values.data() + bounds[i]);
+            }
+        },
+        max_threads);
+
+        for (size_t i = 0;  i < rows;  ++i)
+        {
+            counts[i + 1] += counts[i];
+        }
+        if (counts[rows] > static_cast<size_t>(std::numeric_limits<IT>::max()))
+        {
+            throw runtime_error("sparse matrix index out of range for index type");
+        }
+
+        //- Compact the rows into the arrays of C.
+        //
+        offsets.resize(rows + 1);
+        indices.resize(counts[rows]);
+        values.resize(counts[rows]);
+
+        batch_executor::for_each(chunks, total / chunks, [&](size_t c)
+        {
+            for (size_t i = first_rows[c];  i < first_rows[c + 1];  ++i)
+            {
+                size_t const    n = counts[i + 1] - counts[i];
+
+                std::copy_n(tmp_indices.data() + bounds[i], n, indices.begin() + static_cast<ptrdiff_t>(counts[i]));
+                std::copy_n(tmp_values.data() + bounds[i], n, values.begin() + static_cast<ptrdiff_t>(counts[i]));
+                offsets[i] = static_cast<IT>(counts[i]);
+            }
+        },
+        max_threads);
+
+        offsets[rows] = static_cast<IT>(counts[rows]);
+    }
+
+    //- The values of C = A*B, whose structure is given by C, in the chunks of rows given by
+    //  first_rows, written to the array beginning at pc.
+    //
+    template<class T1, class IT1, class T2, class IT2>
+    static void
+    multiply_row_values(csr_operand<T1, IT1> const& a, csr_operand<T2, IT2> const& b,
+                        std::vector<size_t> const& first_rows, csr_operand<T, IT> const& c, T* pc,
+                        size_t max_threads)
+    {
+        size_t const    chunks = first_rows.size() - 1;
+
+        batch_executor::for_each(chunks, c.row_begin(c.rows) / chunks, [&](size_t ch)
+        {
+            pattern_accumulator     acc(c.cols);
+
+            for (size_t i = first_rows[ch];  i < first_rows[ch + 1];  ++i)
+            {
+                acc.compute_row(a, b, c, i, pc);
+            }
+        },
+        max_threads);
+    }
+
+    //- The dense accumulator of one thread for rows whose columns are known, which sums the
+    //  terms of each column in the same order as row_accumulator, and so gives the same values.
+    //
+    class pattern_accumulator
+    {
+      public:
+        explicit
+        pattern_accumulator(size_t cols)
+        :   m_dense(cols), m_marks(cols, 0)
+        {}
+
+        //- Compute the elements of row i of A*B at the columns of row i of C, writing each to
+        //  its position in the array beginning at pc.
+        //
+        template<class T1, class IT1, class T2, class IT2>
+        void
+        compute_row(csr_operand<T1, IT1> const& a, csr_operand<T2, IT2> const& b,
+                    csr_operand<T, IT> const& c, size_t i, T* pc)
+        {
+            size_t const    listed = 2*i + 1;
+            size_t const    summed = 2*i + 2;
+
+            for (size_t q = c.row_begin(i);  q < c.row_end(i);  ++q)
+            {
+                m_marks[static_cast<size_t>(c.indices[q])] = listed;
+            }
+
+            for (size_t k = a.row_begin(i);  k < a.row_end(i);  ++k)
+            {
+                size_t const    j = static_cast<size_t>(a.indices[k]);
+
+                for (size_t q = b.row_begin(j);  q < b.row_end(j);  ++q)
+                {
+                    size_t const    col  = static_cast<size_t>(b.indices[q]);
+                    AT const        term = accumulator_product<AT, T>(a.values[k], b.values[q]);
+
+                    if (m_marks[col] == summed)
+                    {
+                        m_dense[col] = m_dense[col] + term;
+                    }
+                    else if (m_marks[col] == listed)
+                    {
+                        m_marks[col] = summed;
+                        m_dense[col] = term;
+                    }
+                    else
+                    {
+                        throw runtime_error("sparse product operands do not match its pattern");
+                    }
+                }
+            }
+
+            for (size_t q = c.row_begin(i);  q < c.row_end(i);  ++q)
+            {
+                size_t const    col = static_cast<size_t>(c.indices[q]);
+
+                pc[q] = (m_marks[col] == summed) ? static_cast<T>(m_dense[col]) : T{};
+            }
+        }
+
+      private:
+        std::vector<AT>         m_dense;    //- Dense accumulator, by column
+        std::vector<size_t>     m_marks;    //- 2*row + 1 if listed in the row, 2*row + 2 if summed
+    };
+
+    //- The sparse accumulators of one thread, which are reused for each of its rows.
+    //
+    class row_accumulator
+    {
+      public:
+        explicit
+        row_accumulator(size_t cols)
+        :   m_cols(cols), m_dense(), m_marks(), m_keys(), m_sums(), m_row()
+        {}
+
+        //- Compute row i of A*B, whose number of elements is at most ub, into the arrays
+        //  beginning at pidx and pval, with its columns in increasing order, and return its
+        //  number of elements.
+        //
+        template<class T1, class IT1, class T2, class IT2>
+        size_t
+        compute_row(csr_operand<T1, IT1> const& a, csr_operand<T2, IT2> const& b, size_t i,
+                    size_t ub, IT* pidx, T* pval)
+        {
+            if (ub == 0)
+            {
+                return 0;
+            }
+
+            m_row.clear();
+
+            if (ub * dense_row_ratio >= m_cols)
+            {
+                accumulate_dense(a, b, i);
+            }
+            else
+            {
+                accumulate_hashed(a, b, i, ub);
+            }
+
+            std::sort(m_row.begin(), m_row.end(),
+                      [](auto const& x, auto const& y) { return x.first < y.first; });
+
+            for (size_t t = 0;  t < m_row.size();  ++t)
+            {
+                pidx[t] = static_cast<IT>(m_row[t].first);
+                pval[t] = static_cast<T>(m_row[t].second);
+            }
+            return m_row.size();
+        }
+
+      private:
+        static constexpr size_t     no_key = std::numeric_limits<size_t>::max();
+
+        size_t                              m_cols;
+        std::vector<AT>                     m_dense;    //- Dense accumulator, by column
+        std::vector<size_t>                 m_marks;    //- Row + 1 of each column's last update
+        std::vector<size_t>                 m_keys;     //- Hash table columns, or no_key
+        std::vector<AT>                     m_sums;     //- Hash table sums
+        std::vector<std::pair<size_t, AT>>  m_row;      //- The (column, sum) pairs of the row
+
+        template<class T1, class IT1, class T2, class IT2>
+        void
+        accumulate_dense(csr_operand<T1, IT1> const& a, csr_operand<T2, IT2> const& b, size_t i)
+        {
+            if (m_dense.empty())
+            {
+                m_dense.resize(m_cols);
+                m_marks.assign(m_cols, 0);
+            }
+
+            size_t const    mark = i + 1;
+
+            for (size_t k = a.row_begin(i);  k < a.row_end(i);  ++k)
+            {
+                size_t const    j = static_cast<size_t>(a.indices[k]);
+
+                for (size_t q = b.row_begin(j);  q < b.row_end(j);  ++q)
+                {
+                    size_t const    col  = static_cast<size_t>(b.indices[q]);
+                    AT const        term = accumulator_product<AT, T>(a.values[k], b.values[q]);
+
+                    if (m_marks[col] != mark)
+                    {
+                        m_marks[col] = mark;
+                        m_dense[col] = term;
+                        m_row.emplace_back(col, AT{});
+                    }
+                    else
+                    {
+                        m_dense[col] = m_dense[col] + term;
+                    }
+                }
+            }
+
+            for (auto& e : m_row)
+            {
+                e.second = m_dense[e.first];
+            }
+        }
+
+        template<class T1, class IT1, class T2, class IT2>
+        void
+        accumulate_hashed(csr_operand<T1, IT1> const& a, csr_operand<T2, IT2> const& b, size_t i,
+                          size_t ub)
+        {
+            size_t  capacity = 16;
+
+            while (capacity < 2*ub)
+            {
+                capacity *= 2;
+            }
+            if (m_keys.size() < capacity)
+            {
+                m_keys.assign(capacity, no_key);
+                m_sums.resize(capacity);
+            }
+
+            size_t const    mask = capacity - 1;
+
+            for (size_t k = a.row_begin(i);  k < a.row_end(i);  ++k)
+            {
+                size_t const    j = static_cast<size_t>(a.indices[k]);
+
+                for (size_t q = b.row_begin(j);  q < b.row_end(j);  ++q)
+                {
+                    size_t const    col  = static_cast<size_t>(b.indices[q]);
+                    AT const        term = accumulator_product<AT, T>(a.values[k], b.values[q]);
+                    size_t          h    = (col * 0x9E3779B97F4A7C15ull >> 32) & mask;
+
+                    while (m_keys[h] != no_key  &&  m_keys[h] != col)
+                    {
+                        h = (h + 1) & mask;
+                    }
+                    if (m_keys[h] == no_key)
+                    {
+                        m_keys[h] = col;
+                        m_sums[h] = term;
+                        m_row.emplace_back(h, AT{});
+                    }
+                    else
+                    {
+                        m_sums[h] = m_sums[h] + term;
+                    }
+                }
+            }
+
+            //- Replace each slot by its column, and empty the table for the next row.
+            //
+            for (auto& e : m_row)
+            {
+                size_t const    h = e.first;
+
+                e.first  = m_keys[h];
+                e.second = m_sums[h];
+                m_keys[h] = no_key;
+            }
+        }
+    };
+};
+
+
+//--------------------------------------------------------------------------------------------------
+//  Class Template:     sell_kernel<T, IT, C>
+//
+//  This private type implements products of a sparse matrix A in sliced ELLPACK form, of slice
+//  height C, and a dense vector (SpMV) or a dense matrix (SpMM).  The C rows of a slice are
+//  computed together, one per lane: at each step along the slice, the next element of every row
+//  is multiplied by the element of x at its column index, so that the values are read as C
+//  contiguous elements and the elements of x are gathered, with no dependence between lanes.
+//  Lanes whose row has ended are masked, rather than multiplied by the padding, so that padding
+//  never meets an infinite or NaN element of x.  The C sums are then written to y through the
+//  row permutation.
+//
+//  The slices are divided among the threads at the slice offsets nearest to equal fractions of
+//  the stored elements, padding included, since that is the work of each; each slice writes its
+//  own rows of y.  A strided x is first copied to contiguous storage, so that it may be gathered,
+//  and C = A*B is computed one column of B at a time.
+//--------------------------------------------------------------------------------------------------
+//
+template<class T, class IT, size_t C>
+struct sell_kernel
+{
+    using sparse_type  = sell_operand<T, IT>;
+    using operand_type = dense_operand<T const>;
+    using result_type  = dense_operand<T>;
+    using kernel_type  = sell_slice_kernel<T, IT, C>;
+
+    //- The SIMD kernels gather with signed offsets as wide as the index type, so narrow indices
+    //  must not exceed the largest signed value of that width.
+    //
+    static constexpr size_t     gather_limit =
+        (sizeof(IT) < sizeof(int64_t)) ? static_cast<size_t>(std::numeric_limits<int32_t>::max())
+                                       : std::numeric_limits<size_t>::max();
+
+    //- The portable slice kernel.  The loop over the lanes has no dependence between iterations,
+    //  and so may be vectorized by the compiler as masked gathers.
+    //
+    static void
+    generic_multiply(sparse_type const& a, size_t s0, size_t s1, T const* x, T* y, size_t incy)
+    {
+        for (size_t s = s0;  s < s1;  ++s)
+        {
+            IT const* const     len   = a.lengths + s*C;
+            size_t const        first = a.slice_begin(s);
+            size_t const        width = (a.slice_end(s) - first) / C;
+            T                   acc[C] = {};
+
+            for (size_t p = 0;  p < width;  ++p)
+            {
+                IT const* const     idx = a.indices + first + p*C;
+                T const* const      val = a.values + first + p*C;
+
+                for (size_t l = 0;  l < C;  ++l)
+                {
+                    if (p < static_cast<size_t>(len[l]))
+                    {
+                        acc[l] = acc[l] + val[l] * x[static_cast<size_t>(idx[l])];
+                    }
+                }
+            }
+            store(a, s, acc, y, incy);
+        }
+    }
+
+    //- Write the sums of the rows of slice s, which are in the order of its slots, to y.
+    //
+    static void
+    store(sparse_type const& a, size_t s, T const* sums, T* y, size_t incy) noexcept
+    {
+        size_t const    last = std::min((s + 1)*C, a.rows);
+
+        for (size_t k = s*C;  k < last;  ++k)
+        {
+            y[static_cast<size_t>(a.permutation[k]) * incy] = sums[k - s*C];
+        }
+    }
+
+    //- Prefer a SIMD kernel for the host CPU, if one exists for this element type, index type,
+    //  and slice height.
+    //
+    static kernel_type const&
+    select_kernel() noexcept
+    {
+        static kernel_type const    sk =
+            simd_sell_slice_kernel<T, IT, C>::select(kernel_type{&generic_multiply});
+        return sk;
+    }
+
+    //- Compute y = A*x, using up to max_threads threads.
+    //
+    static void
+    multiply(sparse_type const& a, T const* x, size_t incx, T* y, size_t incy, size_t max_threads)
+    {
+        std::vector<T>  xc;
+
+        if (incx != 1)
+        {
+            xc.resize(a.cols);
+
+            for (size_t j = 0;  j < a.cols;  ++j)
+            {
+                xc[j] = x[j*incx];
+            }
+            x = xc.data();
+        }
+
+        auto const      fn     = (a.cols <= gather_limit) ? select_kernel().multiply : &generic_multiply;
+        size_t const    stored = a.slice_begin(a.slices);
+        size_t const    parts  = std::clamp<size_t>(stored / batch_executor::min_thread_work, 1, max_threads);
+
+        if (parts == 1)
+        {
+            fn(a, 0, a.slices, x, y, incy);
+            return;
+        }
+
+        batch_executor::for_each(parts, stored / parts, [&](size_t t)
+        {
+            fn(a, slice_at(a, t * stored / parts),
+               (t + 1 == parts) ? a.slices : slice_at(a, (t + 1) * stored / parts), x, y, incy);
+        },
+        max_threads);
+    }
+
+    //- Compute C = A*B, using up to max_threads threads.
+    //
+    static void
+    multiply(sparse_type const& a, operand_type b, result_type c, size_t max_threads)
+    {
+        for (size_t j = 0;  j < c.cols;  ++j)
+        {
+            multiply(a, &b(0, j), b.row_stride, &c(0, j), c.row_stride, max_threads);
+        }
+    }
+
+  private:
+    //- Find the first slice beginning at or after the stored element k.
+    //
+    static size_t
+    slice_at(sparse_type const& a, size_t k) noexcept
+    {
+        IT const* const     first = a.offsets;
+        IT const* const     pos   = std::lower_bound(first, first + a.slices, static_cast<IT>(k));
+
+        return static_cast<size_t>(pos - first);
+    }
+};
+
+}       //- detail namespace
+}       //- STD_LA namespace
+#endif  //- LINEAR_ALGEBRA_KERNEL_SUPPORT_HPP_DEFINED
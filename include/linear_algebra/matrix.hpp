@@ -129,6 +129,32 @@ class matrix
         engine_support::assign_from(m_engine, rhs.engine());
     }
 
+    //----------------------------------------------------------
+    //- Construction of a matrix whose owning engine is not writable, such as a sparse engine,
+    //  from an engine object, or from a matrix of different engine type from which such an
+    //  engine may be constructed.
+    //
+    constexpr explicit
+    matrix(engine_type eng)
+    requires
+        detail::is_owning_engine_type_v<engine_type>
+        and
+        (not detail::writable_matrix_engine<engine_type>)
+    :   m_engine(std::move(eng))
+    {}
+
+    template<class ET2, class COT2>
+    constexpr explicit
+    matrix(matrix<ET2, COT2> const& rhs)
+    requires
+        detail::is_owning_engine_type_v<engine_type>
+        and
+        (not detail::writable_matrix_engine<engine_type>)
+        and
+        detail::constructible_from<engine_type, ET2>
+    :   m_engine(rhs.engine())
+    {}
+
     //----------------------------------------------------------
     //- Construction from a 2D mdspan.
     //
@@ -269,7 +295,9 @@ class matrix
     }
 
     //----------------------------------------------------------
-    //- Assignment from a different matrix engine type.
+    //- Assignment from a different matrix engine type.  If the source may refer to elements of
+    //  this matrix at different indices (e.g., A = A.t()), it is first copied to a temporary;
+    //  otherwise, the elements are assigned in place.
     //
     template<class ET2, class COT2>
     constexpr matrix&
@@ -279,7 +307,14 @@ class matrix
         and
         detail::assignable_from<engine_type, ET2>
     {
-        m_engine = rhs.engine();
+        if (engine_support::may_alias(m_engine, rhs.engine()))
+        {
+            engine_support::assign_from(m_engine, detail::temporary_engine_t<ET2>(rhs.engine()));
+        }
+        else
+        {
+            m_engine = rhs.engine();
+        }
         return *this;
     }
 
@@ -293,7 +328,14 @@ class matrix
         and
         detail::convertible_from<element_type, typename ET2::element_type>
     {
-        engine_support::assign_from(m_engine, rhs.engine());
+        if (engine_support::may_alias(m_engine, rhs.engine()))
+        {
+            engine_support::assign_from(m_engine, detail::temporary_engine_t<ET2>(rhs.engine()));
+        }
+        else
+        {
+            engine_support::assign_from(m_engine, rhs.engine());
+        }
         return *this;
     }
 
@@ -605,6 +647,18 @@ class matrix
         return {detail::special_ctor_tag(), m_engine};
     }
 
+    //----------------------------------------------------------
+    //- Assignment and in-place update without alias checking; e.g., A.noalias() = B + C.
+    //  The caller asserts that the right-hand operand does not overlap this matrix.
+    //
+    constexpr matrix_noalias_proxy<engine_type, COT>
+    noalias() noexcept
+    requires
+        detail::writable_matrix_engine<engine_type>
+    {
+        return matrix_noalias_proxy<engine_type, COT>(*this);
+    }
+
     //----------------------------------------------------------
     //- Data access.
     //
@@ -840,5 +894,14 @@ using dynamic_row_vector =
         matrix<matrix_storage_engine<T, 1, std::dynamic_extent, std::allocator<T>, matrix_layout::row_major>, COT>;
 
 
+template<class T, class IT = size_t, class COT = void>
+using sparse_matrix =
+        matrix<sparse_matrix_engine<T, IT, std::allocator<T>>, COT>;
+
+template<class T, class IT = size_t, class COT = void>
+using sliced_ellpack_matrix =
+        matrix<sliced_ellpack_engine<T, IT, std::allocator<T>>, COT>;
+
+
 }       //- STD_LA namespace
 #endif  //- LINEAR_ALGEBRA_MATRIX_HPP_DEFINED
@@ -0,0 +1,289 @@
+//==================================================================================================
+//  File:       matrix_chain.hpp
+//
+//  Summary:    This header defines a public function that computes the product of a chain of
+//              three or more matrices, in the order of evaluation requiring the fewest scalar
+//              multiplications.
+//==================================================================================================
+//
+#ifndef LINEAR_ALGEBRA_MATRIX_CHAIN_HPP_DEFINED
+#define LINEAR_ALGEBRA_MATRIX_CHAIN_HPP_DEFINED
+
+namespace STD_LA {
+namespace detail {
+//--------------------------------------------------------------------------------------------------
+//  Class:      matrix_chain_support
+//
+//  This private type finds the cheapest parenthesization of a chain of N matrix products by the
+//  classic dynamic programming algorithm.  The extents of the operands are given by DIMS, where
+//  operand i has DIMS[i] rows and DIMS[i+1] columns.  Element [i][j] of the returned table is
+//  the index k of the last product performed when computing the sub-chain i..j; i.e., the
+//  sub-chain is computed as (i..k)*(k+1..j).
+//--------------------------------------------------------------------------------------------------
+//
+struct matrix_chain_support
+{
+    template<size_t N>
+    using split_table = array<array<size_t, N>, N>;
+
+    template<size_t N>
+    static constexpr split_table<N>
+    plan(array<size_t, N + 1> const& dims) noexcept
+    {
+        split_table<N>  cost{};
+        split_table<N>  split{};
+
+        for (size_t len = 1;  len < N;  ++len)
+        {
+            for (size_t i = 0;  i + len < N;  ++i)
+            {
+                size_t const    j = i + len;
+
+                cost[i][j] = std::numeric_limits<size_t>::max();
+
+                for (size_t k = i;  k < j;  ++k)
+                {
+                    size_t const    c = cost[i][k] + cost[k + 1][j]
+                                      + dims[i] * dims[k + 1] * dims[j + 1];
+
+                    if (c < cost[i][j])
+                    {
+                        cost[i][j]  = c;
+                        split[i][j] = k;
+                    }
+                }
+            }
+        }
+        return split;
+    }
+};
+
+
+//--------------------------------------------------------------------------------------------------
+//  Class Template:     static_matrix_chain<ETS...>
+//
+//  This private type evaluates a chain of products whose operands all have extents known at
+//  compile time.  The order of evaluation is determined at compile time, and each product is
+//  computed by operator*, so that the fixed-size kernels are used and no memory is allocated.
+//--------------------------------------------------------------------------------------------------
+//
+template<class... ETS>
+struct static_matrix_chain
+{
+    static constexpr size_t     N = sizeof...(ETS);
+
+    static constexpr bool   is_static =
+        ((engine_extents_helper<ETS>::rows() != std::dynamic_extent  and
+          engine_extents_helper<ETS>::columns() != std::dynamic_extent)  and ...);
+
+    static constexpr array<size_t, N + 1>
+    dimensions() noexcept
+    {
+        array<size_t, N>    rows{engine_extents_helper<ETS>::rows()...};
+        array<size_t, N>    cols{engine_extents_helper<ETS>::columns()...};
+        array<size_t, N + 1>    dims{};
+
+        dims[0] = rows[0];
+        for (size_t i = 0;  i < N;  ++i)
+        {
+            dims[i + 1] = cols[i];
+        }
+        return dims;
+    }
+
+    static constexpr bool
+    conformable() noexcept
+    {
+        array<size_t, N>    rows{engine_extents_helper<ETS>::rows()...};
+        array<size_t, N>    cols{engine_extents_helper<ETS>::columns()...};
+
+        for (size_t i = 1;  i < N;  ++i)
+        {
+            if (rows[i] != cols[i - 1]) return false;
+        }
+        return true;
+    }
+
+    template<size_t I, size_t J, class TUP>
+    static constexpr decltype(auto)
+    evaluate(TUP const& ops)
+    {
+        static_assert(conformable(), "mis-matched operand sizes for multiply_chain");
+
+        if constexpr (I == J)
+        {
+            return (std::get<I>(ops));
+        }
+        else
+        {
+            constexpr auto      split = matrix_chain_support::plan<N>(dimensions());
+            constexpr size_t    K     = split[I][J];
+
+            return evaluate<I, K>(ops) * evaluate<K + 1, J>(ops);
+        }
+    }
+};
+
+
+//--------------------------------------------------------------------------------------------------
+//  Class Template:     dynamic_matrix_chain<MTR, MTS...>
+//
+//  This private type evaluates a chain of products, at least one of whose operands has extents
+//  known only at run time.  The order of evaluation is determined at run time.  Each product is
+//  computed by gemm() into a dynamically-sized intermediate matrix, or, for the final product,
+//  into the result.  Intermediates are drawn from a pool and returned to it once they have been
+//  consumed, so that their storage is reused by later products in the chain.
+//--------------------------------------------------------------------------------------------------
+//
+template<class MTR, class... MTS>
+class dynamic_matrix_chain
+{
+    static constexpr size_t     N = sizeof...(MTS);
+
+    using element_type = typename MTR::element_type;
+    using buffer_type  = matrix<matrix_storage_engine<element_type,
+                                                      std::dynamic_extent, std::dynamic_extent,
+                                                      std::allocator<element_type>,
+                                                      matrix_layout::row_major>>;
+    using split_table  = matrix_chain_support::split_table<N>;
+
+  public:
+    constexpr
+    dynamic_matrix_chain(MTS const&... ms)
+    :   m_ops(ms...)
+    ,   m_split()
+    ,   m_pool()
+    ,   m_in_use()
+    {
+        array<size_t, N>        rows{static_cast<size_t>(ms.rows())...};
+        array<size_t, N>        cols{static_cast<size_t>(ms.columns())...};
+        array<size_t, N + 1>    dims{};
+
+        dims[0] = rows[0];
+        for (size_t i = 0;  i < N;  ++i)
+        {
+            if (i > 0  &&  rows[i] != cols[i - 1])
+            {
+                throw runtime_error("mis-matched operand sizes for multiply_chain");
+            }
+            dims[i + 1] = cols[i];
+        }
+        m_split = matrix_chain_support::plan<N>(dims);
+    }
+
+    constexpr void
+    evaluate(MTR& mr)
+    {
+        evaluate(0, N - 1, mr);
+    }
+
+  private:
+    tuple<MTS const&...>    m_ops;
+    split_table             m_split;
+    array<buffer_type, N>   m_pool;
+    array<bool, N>          m_in_use;
+
+    //- Compute the product of sub-chain i..j, where i < j, into DST.
+    //
+    template<class MT>
+    constexpr void
+    evaluate(size_t i, size_t j, MT& dst)
+    {
+        size_t const    k = m_split[i][j];
+
+        with_factor(i, k, [&](auto const& lhs)
+        {
+            with_factor(k + 1, j, [&](auto const& rhs)
+            {
+                gemm(1, lhs, rhs, 0, dst);
+            });
+        });
+    }
+
+    //- Invoke FN with the value of sub-chain i..j; i.e., with operand i if i == j, and with an
+    //  intermediate from the pool otherwise.
+    //
+    template<class FN>
+    constexpr void
+    with_factor(size_t i, size_t j, FN&& fn)
+    {
+        if (i == j)
+        {
+            with_operand(i, fn, std::index_sequence_for<MTS...>());
+        }
+        else
+        {
+            size_t const    b = acquire();
+
+            evaluate(i, j, m_pool[b]);
+            fn(std::as_const(m_pool[b]));
+            m_in_use[b] = false;
+        }
+    }
+
+    template<class FN, size_t... IS>
+    constexpr void
+    with_operand(size_t i, FN& fn, std::index_sequence<IS...>)
+    {
+        ((i == IS ? (fn(std::get<IS>(m_ops)), 0) : 0), ...);
+    }
+
+    constexpr size_t
+    acquire() noexcept
+    {
+        size_t  b = 0;
+
+        while (m_in_use[b]) ++b;
+        m_in_use[b] = true;
+        return b;
+    }
+};
+
+}       //- detail namespace
+
+
+//--------------------------------------------------------------------------------------------------
+//  Function:   multiply_chain(M1, M2, M3, ...)
+//
+//  Computes the product M1*M2*M3*..., choosing the order of evaluation that requires the fewest
+//  scalar multiplications; e.g., A*B*x, where x is a column vector, is computed as A*(B*x).  The
+//  result has the type of the product as it would be computed by operator* from left to right.
+//
+//  If the extents of all operands are known at compile time, the order is chosen at compile
+//  time; otherwise, it is chosen at run time, and the intermediate products are held in
+//  dynamically-sized matrices whose storage is reused from one product to the next.
+//--------------------------------------------------------------------------------------------------
+//
+template<class ET1, class COT1, class ET2, class COT2, class... MTS>
+constexpr auto
+multiply_chain(matrix<ET1, COT1> const& m1, matrix<ET2, COT2> const& m2, MTS const&... ms)
+{
+    using result_type = std::remove_cvref_t<decltype(((m1 * m2) * ... * ms))>;
+    using static_type = detail::static_matrix_chain<ET1, ET2, typename MTS::engine_type...>;
+
+    if constexpr (sizeof...(MTS) == 0)
+    {
+        return result_type(m1 * m2);
+    }
+    else if constexpr (static_type::is_static)
+    {
+        auto const      ops = std::forward_as_tuple(m1, m2, ms...);
+        result_type     mr  = static_type::template evaluate<0, static_type::N - 1>(ops);
+
+        return mr;
+    }
+    else
+    {
+        using chain_type = detail::dynamic_matrix_chain<result_type, matrix<ET1, COT1>,
+                                                        matrix<ET2, COT2>, MTS...>;
+
+        result_type     mr;
+        chain_type      chain(m1, m2, ms...);
+
+        chain.evaluate(mr);
+        return mr;
+    }
+}
+
+}       //- STD_LA namespace
+#endif  //- LINEAR_ALGEBRA_MATRIX_CHAIN_HPP_DEFINED
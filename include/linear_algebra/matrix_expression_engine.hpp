@@ -0,0 +1,512 @@
+//==================================================================================================
+//  File:       matrix_expression_engine.hpp
+//
+//  Summary:    This header defines an engine that represents an unevaluated element-wise
+//              arithmetic expression, whose elements are computed on demand from those of its
+//              operands.
+//==================================================================================================
+//
+#ifndef LINEAR_ALGEBRA_MATRIX_EXPRESSION_ENGINE_HPP_DEFINED
+#define LINEAR_ALGEBRA_MATRIX_EXPRESSION_ENGINE_HPP_DEFINED
+
+namespace STD_LA {
+namespace detail {
+//==================================================================================================
+//  TYPES AND TRAITS DEFINITIONS -- EXPRESSION OPERATIONS
+//==================================================================================================
+//--------------------------------------------------------------------------------------------------
+//  Classes:    expression_add
+//              expression_subtract
+//              expression_multiply
+//              expression_divide
+//
+//  These private types are the element-wise operations that may be applied by an expression
+//  engine to the corresponding elements of its two operands.
+//--------------------------------------------------------------------------------------------------
+//
+struct expression_add
+{
+    template<class T1, class T2>
+    static constexpr auto
+    apply(T1 const& t1, T2 const& t2)
+    {
+        return t1 + t2;
+    }
+};
+
+struct expression_subtract
+{
+    template<class T1, class T2>
+    static constexpr auto
+    apply(T1 const& t1, T2 const& t2)
+    {
+        return t1 - t2;
+    }
+};
+
+struct expression_multiply
+{
+    template<class T1, class T2>
+    static constexpr auto
+    apply(T1 const& t1, T2 const& t2)
+    {
+        return t1 * t2;
+    }
+};
+
+struct expression_divide
+{
+    template<class T1, class T2>
+    static constexpr auto
+    apply(T1 const& t1, T2 const& t2)
+    {
+        return t1 / t2;
+    }
+};
+
+
+//--------------------------------------------------------------------------------------------------
+//  Class Templates:    dense_line<T>
+//                      scalar_line<S>
+//                      expression_line<OP, T, L1, L2>
+//
+//  These private types refer to one row or column, called a line, of an operand of an expression
+//  whose lines are contiguous, so that element j of the line is read from a flat pointer: a
+//  line of a dense engine, a scalar, which has the same value throughout, and a line of an
+//  expression, which applies OP to element j of the lines of its operands.
+//--------------------------------------------------------------------------------------------------
+//
+template<class T>
+struct dense_line
+{
+    T const*    mp_data;
+
+    constexpr T const&
+    operator [](size_t j) const noexcept
+    {
+        return mp_data[j];
+    }
+};
+
+template<class S>
+struct scalar_line
+{
+    S const&    m_value;
+
+    constexpr S const&
+    operator [](size_t) const noexcept
+    {
+        return m_value;
+    }
+};
+
+template<class OP, class T, class L1, class L2>
+struct expression_line
+{
+    L1      m_line1;
+    L2      m_line2;
+
+    constexpr T
+    operator [](size_t j) const
+    {
+        return static_cast<T>(OP::apply(m_line1[j], m_line2[j]));
+    }
+};
+
+
+//--------------------------------------------------------------------------------------------------
+//  Class:      expression_line_support
+//
+//  This private type determines whether the lines of an operand engine of an expression may be
+//  read from flat pointers, and makes them.  A dense engine's line k is row k, or column k if
+//  by_cols is true, which must be contiguous; an expression's lines are made from those of its
+//  operands.
+//--------------------------------------------------------------------------------------------------
+//
+struct expression_line_support
+{
+    template<class ET>
+    static constexpr bool   has_flat_lines = []()
+    {
+        if constexpr (is_matrix_expression_engine_v<ET>)
+        {
+            return ET::has_flat_lines;
+        }
+        else if constexpr (spannable_matrix_engine<ET>)
+        {
+            return is_dense_mdspan_v<get_const_mdspan_type_t<ET>>;
+        }
+        else
+        {
+            return false;
+        }
+    }();
+
+    template<class ET>
+    static constexpr bool
+    flat_lines(ET const& eng, bool by_cols) noexcept
+    {
+        if constexpr (is_matrix_expression_engine_v<ET>)
+        {
+            return eng.flat_lines(by_cols);
+        }
+        else
+        {
+            auto const  sp = eng.span();
+
+            return static_cast<size_t>((by_cols) ? sp.stride(0) : sp.stride(1)) == 1;
+        }
+    }
+
+    template<class ET>
+    static constexpr auto
+    line(ET const& eng, size_t k, bool by_cols) noexcept
+    {
+        if constexpr (is_matrix_expression_engine_v<ET>)
+        {
+            return eng.line(k, by_cols);
+        }
+        else
+        {
+            auto const      sp     = eng.span();
+            size_t const    stride = static_cast<size_t>((by_cols) ? sp.stride(1) : sp.stride(0));
+
+            return dense_line<typename get_const_mdspan_type_t<ET>::element_type>{sp.data_handle() + k*stride};
+        }
+    }
+};
+
+
+//--------------------------------------------------------------------------------------------------
+//  Class Template:     expression_operand<ET>
+//
+//  This private type holds one operand of an expression engine.  An owning engine is referred
+//  to by address, in the same way as by a view engine.  Non-owning engines (views and other
+//  expressions) are small, and are held by value so that an expression may be built from
+//  temporary sub-expressions.  A scalar operand, represented by matrix_scalar_engine<S>, is held
+//  by value and has the same value at every index.
+//--------------------------------------------------------------------------------------------------
+//
+template<class ET>
+struct expression_operand
+{
+    static constexpr bool   is_scalar = false;
+
+    using argument_type = ET;
+    using size_type     = typename ET::size_type;
+
+    ET const*   mp_engine = nullptr;
+
+    constexpr expression_operand() noexcept = default;
+
+    explicit constexpr
+    expression_operand(ET const& eng) noexcept
+    :   mp_engine(&eng)
+    {}
+
+    constexpr ET const&
+    engine() const noexcept
+    {
+        return *mp_engine;
+    }
+
+    constexpr decltype(auto)
+    operator ()(size_type i, size_type j) const
+    {
+        return (*mp_engine)(i, j);
+    }
+
+    static constexpr bool   has_flat_lines = expression_line_support::has_flat_lines<ET>;
+
+    constexpr bool
+    flat_lines(bool by_cols) const noexcept
+    {
+        return expression_line_support::flat_lines(*mp_engine, by_cols);
+    }
+
+    constexpr auto
+    line(size_t k, bool by_cols) const noexcept
+    {
+        return expression_line_support::line(*mp_engine, k, by_cols);
+    }
+};
+
+template<class ET>
+requires
+    (not is_owning_engine_type_v<ET>)
+struct expression_operand<ET>
+{
+    static constexpr bool   is_scalar = false;
+
+    using argument_type = ET;
+    using size_type     = typename ET::size_type;
+
+    ET      m_engine;
+
+    constexpr expression_operand() = default;
+
+    explicit constexpr
+    expression_operand(ET const& eng)
+    :   m_engine(eng)
+    {}
+
+    constexpr ET const&
+    engine() const noexcept
+    {
+        return m_engine;
+    }
+
+    constexpr decltype(auto)
+    operator ()(size_type i, size_type j) const
+    {
+        return m_engine(i, j);
+    }
+
+    static constexpr bool   has_flat_lines = expression_line_support::has_flat_lines<ET>;
+
+    constexpr bool
+    flat_lines(bool by_cols) const noexcept
+    {
+        return expression_line_support::flat_lines(m_engine, by_cols);
+    }
+
+    constexpr auto
+    line(size_t k, bool by_cols) const noexcept
+    {
+        return expression_line_support::line(m_engine, k, by_cols);
+    }
+};
+
+template<class S>
+struct expression_operand<matrix_scalar_engine<S>>
+{
+    static constexpr bool   is_scalar = true;
+
+    using argument_type = S;
+    using size_type     = size_t;
+
+    S       m_value{};
+
+    constexpr expression_operand() = default;
+
+    explicit constexpr
+    expression_operand(S const& s)
+    :   m_value(s)
+    {}
+
+    constexpr S const&
+    operator ()(size_type, size_type) const noexcept
+    {
+        return m_value;
+    }
+
+    static constexpr bool   has_flat_lines = true;
+
+    constexpr bool
+    flat_lines(bool) const noexcept
+    {
+        return true;
+    }
+
+    constexpr scalar_line<S>
+    line(size_t, bool) const noexcept
+    {
+        return scalar_line<S>{m_value};
+    }
+};
+
+}       //- detail namespace
+
+
+//--------------------------------------------------------------------------------------------------
+//  Class Template:     matrix_expression_engine<OET, OP, ET1, ET2>
+//
+//  This class template implements a non-owning, read-only engine for use by class template
+//  matrix<ET, OT>.  It represents the result of applying the element-wise operation OP to the
+//  corresponding elements of engines of type ET1 and ET2, either of which may instead be a
+//  scalar represented by matrix_scalar_engine<S>.  No element is computed until it is read, so
+//  that an expression such as A + B - 2.0*C may be evaluated in a single pass when it is
+//  assigned to a matrix, without creating any intermediate matrices.
+//
+//  OET is the owning engine type that holds the evaluated result; it determines the element,
+//  size, and layout types of the expression.  As with a view, an expression refers to the
+//  owning engines of its operands, and so must not outlive them.
+//
+//  When every operand is a scalar, a dense engine, or another such expression, and the rows
+//  (or columns) of the dense engines are contiguous, an expression assigned to a dense engine
+//  of the same layout is evaluated one row (or column) at a time through flat pointers to
+//  the rows (or columns) of its operands, in a loop that the compiler can vectorize.
+//--------------------------------------------------------------------------------------------------
+//
+template<class OET, class OP, class ET1, class ET2>
+class matrix_expression_engine
+{
+    using this_type      = matrix_expression_engine;
+    using operand_type_1 = detail::expression_operand<ET1>;
+    using operand_type_2 = detail::expression_operand<ET2>;
+    using support_traits = detail::matrix_engine_support;
+
+    static_assert(not (operand_type_1::is_scalar  and  operand_type_2::is_scalar));
+
+  public:
+    using owning_engine_type = OET;
+    using element_type       = typename OET::element_type;
+    using layout_type        = detail::get_layout_t<OET>;
+    using reference          = element_type;
+    using const_reference    = element_type;
+    using size_type          = typename OET::size_type;
+
+    //- Construct/copy/destroy
+    //
+    ~matrix_expression_engine() noexcept = default;
+
+    constexpr matrix_expression_engine() = default;
+    constexpr matrix_expression_engine(matrix_expression_engine&&) noexcept = default;
+    constexpr matrix_expression_engine(matrix_expression_engine const&) = default;
+    constexpr matrix_expression_engine&     operator =(matrix_expression_engine&&) noexcept = default;
+    constexpr matrix_expression_engine&     operator =(matrix_expression_engine const&) = default;
+
+    constexpr
+    matrix_expression_engine(typename operand_type_1::argument_type const& op1,
+                             typename operand_type_2::argument_type const& op2)
+    :   m_op1(op1)
+    ,   m_op2(op2)
+    {}
+
+    //- Size and capacity reporting.
+    //
+    constexpr size_type
+    columns() const noexcept
+    {
+        if constexpr (detail::has_constexpr_columns_v<OET>)
+        {
+            return detail::engine_extents_helper<OET>::columns();
+        }
+        else if constexpr (operand_type_1::is_scalar)
+        {
+            return static_cast<size_type>(m_op2.engine().columns());
+        }
+        else
+        {
+            return static_cast<size_type>(m_op1.engine().columns());
+        }
+    }
+
+    constexpr size_type
+    rows() const noexcept
+    {
+        if constexpr (detail::has_constexpr_rows_v<OET>)
+        {
+            return detail::engine_extents_helper<OET>::rows();
+        }
+        else if constexpr (operand_type_1::is_scalar)
+        {
+            return static_cast<size_type>(m_op2.engine().rows());
+        }
+        else
+        {
+            return static_cast<size_type>(m_op1.engine().rows());
+        }
+    }
+
+    constexpr size_type
+    size() const noexcept
+    {
+        return rows() * columns();
+    }
+
+    constexpr size_type
+    column_capacity() const noexcept
+    {
+        return columns();
+    }
+
+    constexpr size_type
+    row_capacity() const noexcept
+    {
+        return rows();
+    }
+
+    constexpr size_type
+    capacity() const noexcept
+    {
+        return size();
+    }
+
+    //- Element access
+    //
+    constexpr const_reference
+    operator ()(size_type i, size_type j) const
+    {
+        using size_type_1 = typename operand_type_1::size_type;
+        using size_type_2 = typename operand_type_2::size_type;
+
+        return static_cast<element_type>(
+                    OP::apply(m_op1(static_cast<size_type_1>(i), static_cast<size_type_1>(j)),
+                              m_op2(static_cast<size_type_2>(i), static_cast<size_type_2>(j))));
+    }
+
+    //- Line access.  If every operand is a scalar, a dense engine, or such an expression, and
+    //  flat_lines(by_cols) is true, then line(k, by_cols) refers to row k of the expression, or
+    //  column k if by_cols is true, whose elements are computed from flat pointers to the rows
+    //  or columns of the operands, which are all contiguous; the elements are those given by
+    //  the element access above.
+    //
+    static constexpr bool   has_flat_lines = operand_type_1::has_flat_lines and operand_type_2::has_flat_lines;
+
+    constexpr bool
+    flat_lines(bool by_cols) const noexcept
+    requires
+        this_type::has_flat_lines
+    {
+        return m_op1.flat_lines(by_cols)  &&  m_op2.flat_lines(by_cols);
+    }
+
+    constexpr auto
+    line(size_type k, bool by_cols) const noexcept
+    requires
+        this_type::has_flat_lines
+    {
+        using line_type_1 = decltype(m_op1.line(k, by_cols));
+        using line_type_2 = decltype(m_op2.line(k, by_cols));
+
+        return detail::expression_line<OP, element_type, line_type_1, line_type_2>
+                    {m_op1.line(static_cast<size_t>(k), by_cols), m_op2.line(static_cast<size_t>(k), by_cols)};
+    }
+
+    //- Operand inspection.  Returns true if the predicate FN is true for the engine of either
+    //  non-scalar operand; used to determine whether an expression refers to a given engine.
+    //
+    template<class FN>
+    constexpr bool
+    any_operand(FN fn) const
+    {
+        bool    result = false;
+
+        if constexpr (not operand_type_1::is_scalar)
+        {
+            result = fn(m_op1.engine());
+        }
+        if constexpr (not operand_type_2::is_scalar)
+        {
+            result = result  ||  fn(m_op2.engine());
+        }
+        return result;
+    }
+
+    //- Modifiers
+    //
+    constexpr void
+    swap(matrix_expression_engine& rhs) noexcept
+    {
+        support_traits::swap(m_op1, rhs.m_op1);
+        support_traits::swap(m_op2, rhs.m_op2);
+    }
+
+  private:
+    operand_type_1  m_op1;
+    operand_type_2  m_op2;
+};
+
+}       //- STD_LA namespace
+#endif  //- LINEAR_ALGEBRA_MATRIX_EXPRESSION_ENGINE_HPP_DEFINED
@@ -718,16 +718,18 @@ class matrix_storage_engine
         }
         else
         {
+            //- Elements beyond the extents are kept zero, so the extents may also grow in place.
+            //
             if (rows < m_data.m_rows)
             {
                 support_traits::fill_rows(*this, rows, m_data.m_rows, T{});
-                m_data.m_rows = rows;
             }
             if (cols < m_data.m_cols)
             {
                 support_traits::fill_columns(*this, cols, m_data.m_cols, T{});
-                m_data.m_cols = cols;
             }
+            m_data.m_rows = rows;
+            m_data.m_cols = cols;
         }
     }
 
@@ -765,8 +767,8 @@ class matrix_storage_engine
             if (cols < m_data.m_cols)
             {
                 support_traits::fill_columns(*this, cols, m_data.m_cols, T{});
-                m_data.m_cols = cols;
             }
+            m_data.m_cols = cols;
         }
     }
 
@@ -804,8 +806,8 @@ class matrix_storage_engine
             if (rows < m_data.m_rows)
             {
                 support_traits::fill_rows(*this, rows, m_data.m_rows, T{});
-                m_data.m_rows = rows;
             }
+            m_data.m_rows = rows;
         }
     }
 
@@ -841,5 +843,40 @@ class matrix_storage_engine
     }
 };
 
+
+namespace detail {
+//--------------------------------------------------------------------------------------------------
+//  Alias:      temporary_engine_t<ET>
+//
+//  This private alias names the owning engine type used to hold a temporary copy of the
+//  elements of an engine of type ET; for example, a source that aliases the destination of an
+//  assignment.  It is a fixed-size engine if both extents of ET are known at compile time, and a
+//  dynamically-allocated engine otherwise.
+//--------------------------------------------------------------------------------------------------
+//
+template<class ET, size_t R = engine_extents_helper<ET>::rows(),
+                   size_t C = engine_extents_helper<ET>::columns()>
+struct temporary_engine
+{
+    using type = matrix_storage_engine<typename ET::element_type, R, C, void,
+                                       matrix_layout::row_major>;
+};
+
+template<class ET, size_t R, size_t C>
+requires
+    (R == std::dynamic_extent  or  C == std::dynamic_extent)
+struct temporary_engine<ET, R, C>
+{
+    using type = matrix_storage_engine<typename ET::element_type, std::dynamic_extent,
+                                       std::dynamic_extent, std::allocator<typename ET::element_type>,
+                                       matrix_layout::row_major>;
+};
+
+//------
+//
+template<class ET>
+using temporary_engine_t = typename temporary_engine<ET>::type;
+
+}       //- detail namespace
 }       //- STD_LA namespace
 #endif  //- LINEAR_ALGEBRA_MATRIX_STORAGE_ENGINE_HPP_DEFINED
@@ -1933,5 +1933,26 @@ class matrix_view_engine<ET, matrix_view::const_submatrix>
     size_type       m_col_count;
 };
 
+
+//--------------------------------------------------------------------------------------------------
+//  Trait Specializations:  has_runtime_extents<ET>
+//
+//  The extents of submatrix views are chosen at run time, and so are never constexpr, even if
+//  those of the viewed engine are.
+//--------------------------------------------------------------------------------------------------
+//
+namespace detail {
+
+template<class ET>
+struct has_runtime_extents<matrix_view_engine<ET, matrix_view::submatrix>>
+:   public true_type
+{};
+
+template<class ET>
+struct has_runtime_extents<matrix_view_engine<ET, matrix_view::const_submatrix>>
+:   public true_type
+{};
+
+}       //- detail namespace
 }       //- STD_LA namespace
 #endif  //- LINEAR_ALGEBRA_MATRIX_VIEW_ENGINE_HPP_DEFINED
@@ -107,6 +107,30 @@ template<class ET>
 using get_const_mdspan_type_t = typename detect_nested_mdspan_types<ET>::const_mdspan_type;
 
 
+//--------------------------------------------------------------------------------------------------
+//  Trait:      is_dense_mdspan<T>
+//  Variable:   is_dense_mdspan_v<T>
+//
+//  This private traits type determines whether its template parameter is a two-dimensional
+//  mdspan whose elements may be read directly through its data handle; i.e., an mdspan that
+//  uses the default accessor policy.
+//--------------------------------------------------------------------------------------------------
+//
+template<class T>
+struct is_dense_mdspan : public false_type
+{};
+
+template<class T, class IT, size_t X0, size_t X1, class ML>
+struct is_dense_mdspan<mdspan<T, extents<IT, X0, X1>, ML, MDSPAN_NS::default_accessor<T>>>
+:   public true_type
+{};
+
+//------
+//
+template<class T> inline constexpr
+bool    is_dense_mdspan_v = is_dense_mdspan<T>::value;
+
+
 //--------------------------------------------------------------------------------------------------
 //  Types:  negation_accessor<T, WA>
 //          conjugate_accessor<T, WW>
@@ -221,6 +221,20 @@ struct division_arithmetic_traits<COTR, matrix<ET1, COT1>, S2>
         {
             mr.resize(rows, cols);
         }
+        else if constexpr (detail::row_reshapable_matrix_engine<engine_type>)
+        {
+            mr.resize_rows(rows);
+        }
+        else if constexpr (detail::column_reshapable_matrix_engine<engine_type>)
+        {
+            mr.resize_columns(cols);
+        }
+
+        if constexpr (small_fixed_size_engine<engine_type>)
+        {
+            fixed_size_kernel_for<engine_type>::divide_scalar(mr, m1, s2);
+            return mr;
+        }
 
         size_type_r     ir = 0;
         size_type_1     i1 = 0;
@@ -240,6 +254,41 @@ struct division_arithmetic_traits<COTR, matrix<ET1, COT1>, S2>
     }
 };
 
+
+//==================================================================================================
+//                          **** LAZY DIVISION ARITHMETIC TRAITS ****
+//==================================================================================================
+//
+//- The lazy division arithmetic traits are used by `lazy_matrix_operation_traits`.  Like the
+//  lazy addition traits, they return an expression engine instead of a computed quotient.
+//
+template<class COTR, class OP1, class OP2>
+struct lazy_division_arithmetic_traits
+:   public division_arithmetic_traits<COTR, OP1, OP2>
+{};
+
+template<class COTR, class ET1, class COT1, class S2>
+struct lazy_division_arithmetic_traits<COTR, matrix<ET1, COT1>, S2>
+{
+  private:
+    using eager_traits = division_arithmetic_traits<COTR, matrix<ET1, COT1>, S2>;
+
+  public:
+    using element_type = typename eager_traits::element_type;
+    using engine_type  = matrix_expression_engine<typename eager_traits::engine_type,
+                                                  expression_divide, ET1, matrix_scalar_engine<S2>>;
+    using result_type  = matrix<engine_type, COTR>;
+
+    static constexpr result_type
+    divide(matrix<ET1, COT1> const& m1, S2 const& s2)
+    {
+        result_type     mr;
+
+        mr.engine() = engine_type(m1.engine(), s2);
+        return mr;
+    }
+};
+
 }       //- namespace detail
 }       //- STD_LA namespace
 #endif  //- LINEAR_ALGEBRA_OP_TRAITS_DIVISION_HPP_DEFINED
@@ -102,12 +102,65 @@ using multiplication_arithmetic_traits_t = typename multiplication_arithmetic_tr
 //- The standard element division traits type provides the default mechanism for determining
 //  the result of multiplying two elements of (possibly) different types.
 //
+//  The nested type `accumulator_type` is the type in which sums of products are formed by
+//  matrix/matrix and matrix/vector products before being converted to `element_type`.  By
+//  default it is the element type; a custom element traits type may choose a wider type, such
+//  as double for float elements, so that long sums lose less accuracy without the operands
+//  having to be converted up front.  Element traits that omit it accumulate in element_type.
+//
 template<class OT, class T1, class T2>
 struct multiplication_element_traits
 {
-    using element_type = decltype(declval<T1>() * declval<T2>());
+    using element_type     = decltype(declval<T1>() * declval<T2>());
+    using accumulator_type = element_type;
+};
+
+//- The wide element traits type is used by `wide_accumulation_matrix_operation_traits`.  It
+//  accumulates float products in double, and complex<float> products in complex<double>;
+//  other element types are accumulated in themselves.
+//
+template<class T>
+struct wider_accumulator
+{
+    using type = T;
+};
+
+template<>
+struct wider_accumulator<float>
+{
+    using type = double;
+};
+
+template<>
+struct wider_accumulator<std::complex<float>>
+{
+    using type = std::complex<double>;
+};
+
+template<class OT, class T1, class T2>
+struct wide_multiplication_element_traits
+{
+    using element_type     = typename multiplication_element_traits<OT, T1, T2>::element_type;
+    using accumulator_type = typename wider_accumulator<element_type>::type;
+};
+
+//------
+//
+template<typename ETT, typename = void>
+struct multiplication_accumulator_extractor
+{
+    using type = typename ETT::element_type;
 };
 
+template<typename ETT>
+struct multiplication_accumulator_extractor<ETT, void_t<typename ETT::accumulator_type>>
+{
+    using type = typename ETT::accumulator_type;
+};
+
+template<typename ETT>
+using multiplication_accumulator_t = typename multiplication_accumulator_extractor<ETT>::type;
+
 
 //==================================================================================================
 //                           **** MULTIPLICATION LAYOUT TRAITS ****
@@ -287,6 +340,30 @@ struct multiplication_engine_traits<COTR, ET1, matrix_scalar_engine<S2>>
     using engine_type  = matrix_storage_engine<element_type, RR, CR, allocator_type, layout_type>;
 };
 
+//- The product of two sparse matrices is sparse, in the compressed form of the first operand,
+//  and having the wider of their index types.
+//
+template<class COTR, class ET1, class ET2>
+requires
+    compressed_matrix_engine<ET1> and compressed_matrix_engine<ET2>
+struct multiplication_engine_traits<COTR, ET1, ET2>
+{
+  private:
+    using element_type_1 = typename ET1::element_type;
+    using element_type_2 = typename ET2::element_type;
+    using element_traits = multiplication_element_traits_t<COTR, element_type_1, element_type_2>;
+    using elem_type      = typename element_traits::element_type;
+
+    using index_type     = std::common_type_t<typename ET1::index_type, typename ET2::index_type>;
+    using allocator_type = std::allocator<elem_type>;
+    using layout_type    = conditional_t<csr_matrix_engine<ET1>, matrix_layout::row_major,
+                                                                 matrix_layout::column_major>;
+
+  public:
+    using element_type = elem_type;
+    using engine_type  = sparse_matrix_engine<element_type, index_type, allocator_type, layout_type>;
+};
+
 
 //==================================================================================================
 //                          **** MULTIPLICATION ARITHMETIC TRAITS ****
@@ -298,7 +375,7 @@ struct multiplication_engine_traits<COTR, ET1, matrix_scalar_engine<S2>>
 template<class COTR, class ET1, class COT1, class ET2, class COT2>
 struct multiplication_arithmetic_traits<COTR, matrix<ET1, COT1>, matrix<ET2, COT2>>
 {
-    using element_type_1 = typename ET2::element_type;
+    using element_type_1 = typename ET1::element_type;
     using element_type_2 = typename ET2::element_type;
     using element_traits = multiplication_element_traits_t<COTR, element_type_1, element_type_2>;
 
@@ -310,10 +387,20 @@ struct multiplication_arithmetic_traits<COTR, matrix<ET1, COT1>, matrix<ET2, COT
                                  typename engine_traits::engine_type::element_type>);
 
   public:
-    using element_type = typename element_traits::element_type;
-    using engine_type  = typename engine_traits::engine_type;
-    using result_type  = matrix<engine_type, COTR>;
+    using element_type     = typename element_traits::element_type;
+    using accumulator_type = multiplication_accumulator_t<element_traits>;
+    using engine_type      = typename engine_traits::engine_type;
+    using result_type      = matrix<engine_type, COTR>;
+
+  private:
+    static constexpr size_t     inner_extent =
+        (engine_extents_helper<engine_type_1>::columns() != std::dynamic_extent)
+            ? engine_extents_helper<engine_type_1>::columns()
+            : engine_extents_helper<engine_type_2>::rows();
 
+    static constexpr bool   wide_accumulator = not same_as<accumulator_type, element_type>;
+
+  public:
     static constexpr result_type
     multiply(matrix<ET1, COT1> const& m1, matrix<ET2, COT2> const& m2)
     {
@@ -330,27 +417,163 @@ struct multiplication_arithmetic_traits<COTR, matrix<ET1, COT1>, matrix<ET2, COT
         {
             mr.resize(rows, cols);
         }
+        else if constexpr (detail::row_reshapable_matrix_engine<engine_type>)
+        {
+            mr.resize_rows(rows);
+        }
+        else if constexpr (detail::column_reshapable_matrix_engine<engine_type>)
+        {
+            mr.resize_columns(cols);
+        }
 
-        size_type_r     ir = 0;
-        size_type_1     i1 = 0;
+        //- Fully unroll products having small, fixed extents.
+        //
+        if constexpr (small_fixed_size_engine<engine_type>  and  inner_extent <= max_unrolled_extent)
+        {
+            fixed_size_kernel_for<engine_type>::template multiply<inner_extent, accumulator_type>(mr, m1, m2);
+            return mr;
+        }
 
-        for (;  ir < rows;  ++ir, ++i1)
+        //- Use the packed kernel when all three engines expose their elements directly and the
+        //  product is large enough to amortize the cost of packing.  A wider accumulator type
+        //  is honored by converting the operands as they are packed.  Otherwise, the operands
+        //  may also be negation, conjugate, or hermitian views of dense engines (or of their
+        //  transposes), which the kernel unwraps into flags, so that no view is copied; and a
+        //  product of an operand with its own transpose, such as A.t()*A or A*A.h(), is
+        //  symmetric (or Hermitian), so only one triangle of it is computed.
+        //
+        if constexpr (gemm_engines<engine_type, engine_type_1, engine_type_2>  and
+                      wide_accumulator  and  gemm_element<accumulator_type>)
+        {
+            using kernel_type = mixed_gemm_kernel<element_type, accumulator_type>;
+
+            size_t const    work = static_cast<size_t>(rows) * static_cast<size_t>(cols)
+                                 * static_cast<size_t>(inner);
+
+            if (not std::is_constant_evaluated()  &&  work >= kernel_type::blocking_traits::min_work)
+            {
+                kernel_type::multiply(element_type{1},
+                                      make_dense_operand(m1.span()),
+                                      make_dense_operand(m2.span()),
+                                      element_type{},
+                                      make_dense_operand(mr.span()));
+                return mr;
+            }
+        }
+        else if constexpr (view_gemm_engines<engine_type, engine_type_1, engine_type_2>  and
+                           not wide_accumulator)
+        {
+            using kernel_type = gemm_kernel<element_type>;
+
+            size_t const    work = static_cast<size_t>(rows) * static_cast<size_t>(cols)
+                                 * static_cast<size_t>(inner);
+
+            if (not std::is_constant_evaluated()  &&  work >= kernel_type::blocking_traits::min_work)
+            {
+                kernel_type::multiply(element_type{1},
+                                      make_view_operand(m1.span()),
+                                      make_view_operand(m2.span()),
+                                      element_type{},
+                                      make_dense_operand(mr.span()));
+                return mr;
+            }
+        }
+
+        //- Otherwise, choose a loop order from the layouts of the operands and the result.
+        //  A row-major A and column-major B are best traversed as dot products, in i-j-k
+        //  order.  Else, the result is traversed contiguously: i-k-j for a row-major result,
+        //  which also streams along the rows of B, and j-k-i for a column-major result, which
+        //  also streams along the columns of A.  In every case, each result element
+        //  accumulates its terms in the same order.  A wider accumulator type requires the
+        //  dot product order, so that each sum is held in an accumulator until complete.
+        //
+        using layout_type_1 = get_layout_t<engine_type_1>;
+        using layout_type_2 = get_layout_t<engine_type_2>;
+        using layout_type_r = get_layout_t<engine_type>;
+
+        constexpr bool  use_dot = (same_as<layout_type_1, matrix_layout::row_major>
+                                   and same_as<layout_type_2, matrix_layout::column_major>)
+                                  or wide_accumulator;
+
+        if constexpr (not use_dot  and  same_as<layout_type_r, matrix_layout::row_major>)
+        {
+            size_type_r     ir = 0;
+            size_type_1     i1 = 0;
+
+            for (;  ir < rows;  ++ir, ++i1)
+            {
+                for (size_type_r jr = 0;  jr < cols;  ++jr)
+                {
+                    mr(ir, jr) = element_type{};
+                }
+
+                size_type_1     k1 = 0;
+                size_type_2     k2 = 0;
+
+                for (;  k1 < inner;  ++k1, ++k2)
+                {
+                    auto const&     e1 = m1(i1, k1);
+                    size_type_r     jr = 0;
+                    size_type_2     j2 = 0;
+
+                    for (;  jr < cols;  ++jr, ++j2)
+                    {
+                        mr(ir, jr) = mr(ir, jr) + (e1 * m2(k2, j2));
+                    }
+                }
+            }
+        }
+        else if constexpr (not use_dot  and  same_as<layout_type_r, matrix_layout::column_major>)
         {
             size_type_r     jr = 0;
             size_type_2     j2 = 0;
 
             for (;  jr < cols;  ++jr, ++j2)
             {
-                element_type    er{};
+                for (size_type_r ir = 0;  ir < rows;  ++ir)
+                {
+                    mr(ir, jr) = element_type{};
+                }
+
                 size_type_1     k1 = 0;
                 size_type_2     k2 = 0;
 
-                for (k1 = 0, k2 = 0;  k1 < inner;  ++k1, ++k2)
+                for (;  k1 < inner;  ++k1, ++k2)
                 {
-                    er = er + (m1(i1, k1) * m2(k2, j2));
+                    auto const&     e2 = m2(k2, j2);
+                    size_type_r     ir = 0;
+                    size_type_1     i1 = 0;
+
+                    for (;  ir < rows;  ++ir, ++i1)
+                    {
+                        mr(ir, jr) = mr(ir, jr) + (m1(i1, k1) * e2);
+                    }
                 }
+            }
+        }
+        else
+        {
+            size_type_r     ir = 0;
+            size_type_1     i1 = 0;
+
+            for (;  ir < rows;  ++ir, ++i1)
+            {
+                size_type_r     jr = 0;
+                size_type_2     j2 = 0;
+
+                for (;  jr < cols;  ++jr, ++j2)
+                {
+                    accumulator_type    er{};
+                    size_type_1         k1 = 0;
+                    size_type_2         k2 = 0;
+
+                    for (k1 = 0, k2 = 0;  k1 < inner;  ++k1, ++k2)
+                    {
+                        er = er + accumulator_product<accumulator_type, element_type>(m1(i1, k1), m2(k2, j2));
+                    }
 
-                mr(ir, jr) = er;
+                    mr(ir, jr) = static_cast<element_type>(er);
+                }
             }
         }
 
@@ -359,14 +582,23 @@ struct multiplication_arithmetic_traits<COTR, matrix<ET1, COT1>, matrix<ET2, COT
 };
 
 
-template<class COTR, class S1, class ET2, class COT2>
-struct multiplication_arithmetic_traits<COTR, S1, matrix<ET2, COT2>>
+//- This specialization handles products in which the second operand is a column vector, the
+//  first operand is a row vector, or both; i.e., matrix-vector products of the form A*x and
+//  x^T*A, and dot products.  They are computed by the GEMV and dot product kernels, which make
+//  a single streaming pass over the matrix operand, instead of the general matrix product.
+//
+template<class COTR, class ET1, class COT1, class ET2, class COT2>
+requires
+    (column_vector_engine<ET2> or row_vector_engine<ET1>)
+    and
+    (not compressed_matrix_engine<ET1>) and (not sell_matrix_engine<ET1>)
+struct multiplication_arithmetic_traits<COTR, matrix<ET1, COT1>, matrix<ET2, COT2>>
 {
-    using element_type_1 = S1;
+    using element_type_1 = typename ET1::element_type;
     using element_type_2 = typename ET2::element_type;
     using element_traits = multiplication_element_traits_t<COTR, element_type_1, element_type_2>;
 
-    using engine_type_1 = matrix_scalar_engine<S1>;
+    using engine_type_1 = typename matrix<ET1, COT1>::engine_type;
     using engine_type_2 = typename matrix<ET2, COT2>::engine_type;
     using engine_traits = multiplication_engine_traits_t<COTR, engine_type_1, engine_type_2>;
 
@@ -374,36 +606,114 @@ struct multiplication_arithmetic_traits<COTR, S1, matrix<ET2, COT2>>
                                  typename engine_traits::engine_type::element_type>);
 
   public:
-    using element_type = typename element_traits::element_type;
-    using engine_type  = typename engine_traits::engine_type;
-    using result_type  = matrix<engine_type, COTR>;
+    using element_type     = typename element_traits::element_type;
+    using accumulator_type = multiplication_accumulator_t<element_traits>;
+    using engine_type      = typename engine_traits::engine_type;
+    using result_type      = matrix<engine_type, COTR>;
+
+  private:
+    static constexpr size_t     inner_extent =
+        (engine_extents_helper<engine_type_1>::columns() != std::dynamic_extent)
+            ? engine_extents_helper<engine_type_1>::columns()
+            : engine_extents_helper<engine_type_2>::rows();
+
+    static constexpr bool   wide_accumulator = not same_as<accumulator_type, element_type>;
 
+  public:
     static constexpr result_type
-    multiply(S1 const& s1, matrix<ET2, COT2> const& m2)
+    multiply(matrix<ET1, COT1> const& m1, matrix<ET2, COT2> const& m2)
     {
+        using size_type_1 = typename matrix<ET1, COT1>::size_type;
         using size_type_2 = typename matrix<ET2, COT2>::size_type;
         using size_type_r = typename result_type::size_type;
 
-        size_type_r     rows = static_cast<size_type_r>(m2.rows());
-        size_type_r     cols = static_cast<size_type_r>(m2.columns());
+        size_type_r     rows  = static_cast<size_type_r>(m1.rows());
+        size_type_r     cols  = static_cast<size_type_r>(m2.columns());
+        size_type_1     inner = m1.columns();
         result_type		mr;
 
         if constexpr (detail::reshapable_matrix_engine<engine_type>)
         {
             mr.resize(rows, cols);
         }
+        else if constexpr (detail::row_reshapable_matrix_engine<engine_type>)
+        {
+            mr.resize_rows(rows);
+        }
+        else if constexpr (detail::column_reshapable_matrix_engine<engine_type>)
+        {
+            mr.resize_columns(cols);
+        }
+
+        //- Fully unroll products having small, fixed extents.
+        //
+        if constexpr (small_fixed_size_engine<engine_type>  and  inner_extent <= max_unrolled_extent)
+        {
+            fixed_size_kernel_for<engine_type>::template multiply<inner_extent, accumulator_type>(mr, m1, m2);
+            return mr;
+        }
+
+        //- Use the dense kernels when all three engines expose their elements directly, or the
+        //  operands are transpose or negation views of such engines.  A product x^T*A is
+        //  computed as y = A^T*x, with y stored in the single row of the result, and the result
+        //  is negated afterward if exactly one operand is negated.  These accumulate in the
+        //  element type, so a wider accumulator type uses the loops.
+        //
+        if constexpr (view_addition_engines<engine_type, engine_type_1, engine_type_2>  and
+                      not wide_accumulator)
+        {
+            if (not std::is_constant_evaluated())
+            {
+                using kernel_type = gemv_kernel<element_type>;
+
+                auto const  a = make_view_operand(m1.span());
+                auto const  b = make_view_operand(m2.span());
+                auto const  r = make_dense_operand(mr.span());
+
+                if constexpr (row_vector_engine<ET1>  and  column_vector_engine<ET2>)
+                {
+                    r(0, 0) = kernel_type::dot(a.op.cols, a.op.data, a.op.col_stride,
+                                               b.op.data, b.op.row_stride);
+                }
+                else if constexpr (column_vector_engine<ET2>)
+                {
+                    kernel_type::multiply(a.op, b.op.data, b.op.row_stride, r.data, r.row_stride);
+                }
+                else
+                {
+                    kernel_type::multiply(b.op.transposed(), a.op.data, a.op.col_stride,
+                                          r.data, r.col_stride);
+                }
+                if (a.negate != b.negate)
+                {
+                    kernel_type::negate(r);
+                }
+                return mr;
+            }
+        }
 
+        //- Otherwise, compute each element of the result as a dot product.
+        //
         size_type_r     ir = 0;
-        size_type_2     i2 = 0;
+        size_type_1     i1 = 0;
 
-        for (;  ir < rows;  ++ir, ++i2)
+        for (;  ir < rows;  ++ir, ++i1)
         {
             size_type_r     jr = 0;
             size_type_2     j2 = 0;
 
             for (;  jr < cols;  ++jr, ++j2)
             {
-                mr(ir, jr) = s1 * m2(i2, j2);
+                accumulator_type    er{};
+                size_type_1         k1 = 0;
+                size_type_2         k2 = 0;
+
+                for (;  k1 < inner;  ++k1, ++k2)
+                {
+                    er = er + accumulator_product<accumulator_type, element_type>(m1(i1, k1), m2(k2, j2));
+                }
+
+                mr(ir, jr) = static_cast<element_type>(er);
             }
         }
 
@@ -411,52 +721,156 @@ struct multiplication_arithmetic_traits<COTR, S1, matrix<ET2, COT2>>
     }
 };
 
-
-template<class COTR, class ET1, class COT1, class S2>
-struct multiplication_arithmetic_traits<COTR, matrix<ET1, COT1>, S2>
+//- This specialization handles products in which the first operand is a sparse matrix stored in
+//  compressed sparse row or column form, and the second is a vector or matrix; i.e., SpMV and
+//  SpMM.  Only the non-zero elements of the first operand are visited: for CSR, each row of the
+//  result is formed from the rows of the second operand selected by the column indices of the
+//  corresponding row of the first; for CSC, each row of the second operand is scattered into
+//  the rows of the result selected by the row indices of the corresponding column of the first.
+//  The result is dense.
+//
+template<class COTR, class ET1, class COT1, class ET2, class COT2>
+requires
+    compressed_matrix_engine<ET1>
+struct multiplication_arithmetic_traits<COTR, matrix<ET1, COT1>, matrix<ET2, COT2>>
 {
     using element_type_1 = typename ET1::element_type;
-    using element_type_2 = S2;
+    using element_type_2 = typename ET2::element_type;
     using element_traits = multiplication_element_traits_t<COTR, element_type_1, element_type_2>;
 
     using engine_type_1 = typename matrix<ET1, COT1>::engine_type;
-    using engine_type_2 = matrix_scalar_engine<S2>;
+    using engine_type_2 = typename matrix<ET2, COT2>::engine_type;
     using engine_traits = multiplication_engine_traits_t<COTR, engine_type_1, engine_type_2>;
 
     static_assert(std::is_same_v<typename element_traits::element_type,
                                  typename engine_traits::engine_type::element_type>);
 
   public:
-    using element_type = typename element_traits::element_type;
-    using engine_type  = typename engine_traits::engine_type;
-    using result_type  = matrix<engine_type, COTR>;
+    using element_type     = typename element_traits::element_type;
+    using accumulator_type = multiplication_accumulator_t<element_traits>;
+    using engine_type      = typename engine_traits::engine_type;
+    using result_type      = matrix<engine_type, COTR>;
+
+  private:
+    static constexpr bool   wide_accumulator = not same_as<accumulator_type, element_type>;
+    static constexpr bool   transposed       = csc_matrix_engine<ET1>;
 
+  public:
     static constexpr result_type
-    multiply(matrix<ET1, COT1> const& m1, S2 const& s2)
+    multiply(matrix<ET1, COT1> const& m1, matrix<ET2, COT2> const& m2)
     {
-        using size_type_1 = typename matrix<ET1, COT1>::size_type;
+        using size_type_2 = typename matrix<ET2, COT2>::size_type;
         using size_type_r = typename result_type::size_type;
 
         size_type_r     rows = static_cast<size_type_r>(m1.rows());
-        size_type_r     cols = static_cast<size_type_r>(m1.columns());
-        result_type		mr;
+        size_type_r     cols = static_cast<size_type_r>(m2.columns());
+        result_type     mr;
+
+        if (matrix_engine_support::sizes_differ(m1.columns(), m2.rows()))
+        {
+            throw runtime_error("mis-matched operand sizes for multiplication");
+        }
 
         if constexpr (detail::reshapable_matrix_engine<engine_type>)
         {
             mr.resize(rows, cols);
         }
+        else if constexpr (detail::row_reshapable_matrix_engine<engine_type>)
+        {
+            mr.resize_rows(rows);
+        }
+        else if constexpr (detail::column_reshapable_matrix_engine<engine_type>)
+        {
+            mr.resize_columns(cols);
+        }
 
-        size_type_r     ir = 0;
-        size_type_1     i1 = 0;
+        //- For CSC, this describes the transpose of the first operand.
+        //
+        auto const  a = make_csr_operand(m1.engine());
 
-        for (;  ir < rows;  ++ir, ++i1)
+        //- Use the sparse kernel when the second operand and the result expose their elements
+        //  directly.  It accumulates in the element type, so a wider accumulator type uses the
+        //  loops.
+        //
+        if constexpr (sparse_product_engines<engine_type, engine_type_1, engine_type_2>  and
+                      not wide_accumulator)
         {
-            size_type_r     jr = 0;
-            size_type_1     j1 = 0;
+            if (not std::is_constant_evaluated())
+            {
+                using index_type  = typename ET1::index_type;
+                using kernel_type = sparse_kernel<element_type, index_type>;
 
-            for (;  jr < cols;  ++jr, ++j1)
+                auto const  b = make_dense_operand(m2.span());
+                auto const  c = make_dense_operand(mr.span());
+
+                //- Products of CSR are divided among the threads by non-zero elements; those
+                //  of CSC scatter into the whole result, and are computed by this thread.
+                //
+                if constexpr (transposed)
+                {
+                    kernel_type::multiply_transpose(a, b, c);
+                }
+                else
+                {
+                    parallel_sparse_kernel<element_type, index_type>::multiply(
+                        a, b, c, std::max(std::thread::hardware_concurrency(), 1u));
+                }
+                return mr;
+            }
+        }
+
+        //- Otherwise, for CSC, scatter each column of the first operand into a column of
+        //  accumulators, one column of the result at a time.
+        //
+        if constexpr (transposed)
+        {
+            std::vector<accumulator_type>   acc(static_cast<size_t>(rows));
+
+            for (size_type_r jr = 0;  jr < cols;  ++jr)
             {
-                mr(ir, jr) = m1(i1, j1) * s2;
+                size_type_2 const   j2 = static_cast<size_type_2>(jr);
+
+                std::fill(acc.begin(), acc.end(), accumulator_type{});
+
+                for (size_t p = 0;  p < a.rows;  ++p)
+                {
+                    auto const  bp = m2(static_cast<size_type_2>(p), j2);
+
+                    for (size_t k = a.row_begin(p);  k < a.row_end(p);  ++k)
+                    {
+                        accumulator_type&   ei = acc[static_cast<size_t>(a.indices[k])];
+
+                        ei = ei + accumulator_product<accumulator_type, element_type>(a.values[k], bp);
+                    }
+                }
+
+                for (size_type_r ir = 0;  ir < rows;  ++ir)
+                {
+                    mr(ir, jr) = static_cast<element_type>(acc[static_cast<size_t>(ir)]);
+                }
+            }
+            return mr;
+        }
+
+        //- Otherwise, for CSR, compute each element of the result as a sparse dot product.
+        //
+        for (size_type_r ir = 0;  ir < rows;  ++ir)
+        {
+            size_t const    i = static_cast<size_t>(ir);
+
+            for (size_type_r jr = 0;  jr < cols;  ++jr)
+            {
+                size_type_2 const   j2 = static_cast<size_type_2>(jr);
+                accumulator_type    er{};
+
+                for (size_t k = a.row_begin(i);  k < a.row_end(i);  ++k)
+                {
+                    size_type_2 const   k2 = static_cast<size_type_2>(a.indices[k]);
+
+                    er = er + accumulator_product<accumulator_type, element_type>(a.values[k], m2(k2, j2));
+                }
+
+                mr(ir, jr) = static_cast<element_type>(er);
             }
         }
 
@@ -464,6 +878,642 @@ struct multiplication_arithmetic_traits<COTR, matrix<ET1, COT1>, S2>
     }
 };
 
+//- This specialization handles products in which the first operand is a sparse matrix stored in
+//  sliced ELLPACK form, and the second is a vector or matrix.  Each row of the result is formed
+//  from the rows of the second operand selected by the column indices of the corresponding row
+//  of the first, as for CSR, but the rows are computed a slice at a time by the sliced ELLPACK
+//  kernel when the operands allow it.  The result is dense.
+//
+template<class COTR, class ET1, class COT1, class ET2, class COT2>
+requires
+    sell_matrix_engine<ET1>
+struct multiplication_arithmetic_traits<COTR, matrix<ET1, COT1>, matrix<ET2, COT2>>
+{
+    using element_type_1 = typename ET1::element_type;
+    using element_type_2 = typename ET2::element_type;
+    using element_traits = multiplication_element_traits_t<COTR, element_type_1, element_type_2>;
+
+    using engine_type_1 = typename matrix<ET1, COT1>::engine_type;
+    using engine_type_2 = typename matrix<ET2, COT2>::engine_type;
+    using engine_traits = multiplication_engine_traits_t<COTR, engine_type_1, engine_type_2>;
+
+    static_assert(std::is_same_v<typename element_traits::element_type,
+                                 typename engine_traits::engine_type::element_type>);
+
+  public:
+    using element_type     = typename element_traits::element_type;
+    using accumulator_type = multiplication_accumulator_t<element_traits>;
+    using engine_type      = typename engine_traits::engine_type;
+    using result_type      = matrix<engine_type, COTR>;
+
+  private:
+    static constexpr bool   wide_accumulator = not same_as<accumulator_type, element_type>;
+
+  public:
+    static constexpr result_type
+    multiply(matrix<ET1, COT1> const& m1, matrix<ET2, COT2> const& m2)
+    {
+        using size_type_2 = typename matrix<ET2, COT2>::size_type;
+        using size_type_r = typename result_type::size_type;
+
+        size_type_r     rows = static_cast<size_type_r>(m1.rows());
+        size_type_r     cols = static_cast<size_type_r>(m2.columns());
+        result_type     mr;
+
+        if (matrix_engine_support::sizes_differ(m1.columns(), m2.rows()))
+        {
+            throw runtime_error("mis-matched operand sizes for multiplication");
+        }
+
+        if constexpr (detail::reshapable_matrix_engine<engine_type>)
+        {
+            mr.resize(rows, cols);
+        }
+        else if constexpr (detail::row_reshapable_matrix_engine<engine_type>)
+        {
+            mr.resize_rows(rows);
+        }
+        else if constexpr (detail::column_reshapable_matrix_engine<engine_type>)
+        {
+            mr.resize_columns(cols);
+        }
+
+        //- Use the sliced ELLPACK kernel when the second operand and the result expose their
+        //  elements directly.  It accumulates in the element type, so a wider accumulator type
+        //  uses the loops.
+        //
+        if constexpr (sparse_product_engines<engine_type, engine_type_1, engine_type_2>  and
+                      not wide_accumulator)
+        {
+            if (not std::is_constant_evaluated())
+            {
+                using index_type  = typename ET1::index_type;
+                using kernel_type = sell_kernel<element_type, index_type, ET1::slice_height>;
+
+                kernel_type::multiply(make_sell_operand(m1.engine()),
+                                      make_dense_operand(m2.span()), make_dense_operand(mr.span()),
+                                      std::max(std::thread::hardware_concurrency(), 1u));
+                return mr;
+            }
+        }
+
+        //- Otherwise, compute each element of the result as a sparse dot product of the row in
+        //  each slot of the first operand, whose elements are C positions apart.
+        //
+        constexpr size_t    C = ET1::slice_height;
+        auto const          a = make_sell_operand(m1.engine());
+
+        for (size_t k = 0;  k < a.rows;  ++k)
+        {
+            size_type_r const   ir    = static_cast<size_type_r>(a.permutation[k]);
+            size_t const        first = a.slice_begin(k / C) + k % C;
+            size_t const        last  = first + static_cast<size_t>(a.lengths[k]) * C;
+
+            for (size_type_r jr = 0;  jr < cols;  ++jr)
+            {
+                size_type_2 const   j2 = static_cast<size_type_2>(jr);
+                accumulator_type    er{};
+
+                for (size_t q = first;  q < last;  q += C)
+                {
+                    size_type_2 const   k2 = static_cast<size_type_2>(a.indices[q]);
+
+                    er = er + accumulator_product<accumulator_type, element_type>(a.values[q], m2(k2, j2));
+                }
+
+                mr(ir, jr) = static_cast<element_type>(er);
+            }
+        }
+
+        return mr;
+    }
+};
+
+//- This specialization handles products of two sparse matrices (SpGEMM), which are computed by
+//  the sparse product kernel without forming any dense intermediate, in parallel when they are
+//  large enough.  Operands in different compressed forms are first converted to the form of
+//  the result, which is that of the first operand.  The symbolic phase may be recorded in a
+//  sparse_product_pattern, with which multiply_values() recomputes only the values.
+//
+template<class COTR, class ET1, class COT1, class ET2, class COT2>
+requires
+    compressed_matrix_engine<ET1> and compressed_matrix_engine<ET2>
+struct multiplication_arithmetic_traits<COTR, matrix<ET1, COT1>, matrix<ET2, COT2>>
+{
+    using element_type_1 = typename ET1::element_type;
+    using element_type_2 = typename ET2::element_type;
+    using element_traits = multiplication_element_traits_t<COTR, element_type_1, element_type_2>;
+
+    using engine_type_1 = typename matrix<ET1, COT1>::engine_type;
+    using engine_type_2 = typename matrix<ET2, COT2>::engine_type;
+    using engine_traits = multiplication_engine_traits_t<COTR, engine_type_1, engine_type_2>;
+
+    static_assert(std::is_same_v<typename element_traits::element_type,
+                                 typename engine_traits::engine_type::element_type>);
+
+  public:
+    using element_type     = typename element_traits::element_type;
+    using accumulator_type = multiplication_accumulator_t<element_traits>;
+    using engine_type      = typename engine_traits::engine_type;
+    using result_type      = matrix<engine_type, COTR>;
+
+    static result_type
+    multiply(matrix<ET1, COT1> const& m1, matrix<ET2, COT2> const& m2)
+    {
+        sparse_product_pattern  pattern;
+
+        return multiply(pattern, m1, m2);
+    }
+
+    //- The product, recording its symbolic phase in pattern.
+    //
+    static result_type
+    multiply(sparse_product_pattern& pattern, matrix<ET1, COT1> const& m1, matrix<ET2, COT2> const& m2)
+    {
+        if (matrix_engine_support::sizes_differ(m1.columns(), m2.rows()))
+        {
+            throw runtime_error("mis-matched operand sizes for multiplication");
+        }
+
+        size_t const    rows = static_cast<size_t>(m1.rows());
+        size_t const    cols = static_cast<size_t>(m2.columns());
+
+        typename engine_type::index_array_type      offsets;
+        typename engine_type::index_array_type      indices;
+        typename engine_type::element_array_type    values;
+
+        kernel_type::multiply(m1.engine(), m2.engine(), pattern, offsets, indices, values, max_threads());
+
+        return result_type(engine_type(rows, cols, std::move(offsets), std::move(indices), std::move(values)));
+    }
+
+    //- Recompute the values of the product mr, whose symbolic phase was recorded in pattern.
+    //
+    static void
+    multiply_values(sparse_product_pattern const& pattern, matrix<ET1, COT1> const& m1,
+                    matrix<ET2, COT2> const& m2, result_type& mr)
+    {
+        kernel_type::multiply_values(m1.engine(), m2.engine(), pattern, mr.engine(), max_threads());
+    }
+
+  private:
+    using kernel_type = spgemm_kernel<element_type, accumulator_type, typename engine_type::index_type>;
+
+    static size_t
+    max_threads() noexcept
+    {
+        return std::max(std::thread::hardware_concurrency(), 1u);
+    }
+};
+
+template<class COTR, class S1, class ET2, class COT2>
+struct multiplication_arithmetic_traits<COTR, S1, matrix<ET2, COT2>>
+{
+    using element_type_1 = S1;
+    using element_type_2 = typename ET2::element_type;
+    using element_traits = multiplication_element_traits_t<COTR, element_type_1, element_type_2>;
+
+    using engine_type_1 = matrix_scalar_engine<S1>;
+    using engine_type_2 = typename matrix<ET2, COT2>::engine_type;
+    using engine_traits = multiplication_engine_traits_t<COTR, engine_type_1, engine_type_2>;
+
+    static_assert(std::is_same_v<typename element_traits::element_type,
+                                 typename engine_traits::engine_type::element_type>);
+
+  public:
+    using element_type = typename element_traits::element_type;
+    using engine_type  = typename engine_traits::engine_type;
+    using result_type  = matrix<engine_type, COTR>;
+
+    static constexpr result_type
+    multiply(S1 const& s1, matrix<ET2, COT2> const& m2)
+    {
+        using size_type_2 = typename matrix<ET2, COT2>::size_type;
+        using size_type_r = typename result_type::size_type;
+
+        size_type_r     rows = static_cast<size_type_r>(m2.rows());
+        size_type_r     cols = static_cast<size_type_r>(m2.columns());
+        result_type		mr;
+
+        if constexpr (detail::reshapable_matrix_engine<engine_type>)
+        {
+            mr.resize(rows, cols);
+        }
+        else if constexpr (detail::row_reshapable_matrix_engine<engine_type>)
+        {
+            mr.resize_rows(rows);
+        }
+        else if constexpr (detail::column_reshapable_matrix_engine<engine_type>)
+        {
+            mr.resize_columns(cols);
+        }
+
+        if constexpr (small_fixed_size_engine<engine_type>)
+        {
+            fixed_size_kernel_for<engine_type>::multiply_scalar_left(mr, s1, m2);
+            return mr;
+        }
+
+        size_type_r     ir = 0;
+        size_type_2     i2 = 0;
+
+        for (;  ir < rows;  ++ir, ++i2)
+        {
+            size_type_r     jr = 0;
+            size_type_2     j2 = 0;
+
+            for (;  jr < cols;  ++jr, ++j2)
+            {
+                mr(ir, jr) = s1 * m2(i2, j2);
+            }
+        }
+
+        return mr;
+    }
+};
+
+
+template<class COTR, class ET1, class COT1, class S2>
+struct multiplication_arithmetic_traits<COTR, matrix<ET1, COT1>, S2>
+{
+    using element_type_1 = typename ET1::element_type;
+    using element_type_2 = S2;
+    using element_traits = multiplication_element_traits_t<COTR, element_type_1, element_type_2>;
+
+    using engine_type_1 = typename matrix<ET1, COT1>::engine_type;
+    using engine_type_2 = matrix_scalar_engine<S2>;
+    using engine_traits = multiplication_engine_traits_t<COTR, engine_type_1, engine_type_2>;
+
+    static_assert(std::is_same_v<typename element_traits::element_type,
+                                 typename engine_traits::engine_type::element_type>);
+
+  public:
+    using element_type = typename element_traits::element_type;
+    using engine_type  = typename engine_traits::engine_type;
+    using result_type  = matrix<engine_type, COTR>;
+
+    static constexpr result_type
+    multiply(matrix<ET1, COT1> const& m1, S2 const& s2)
+    {
+        using size_type_1 = typename matrix<ET1, COT1>::size_type;
+        using size_type_r = typename result_type::size_type;
+
+        size_type_r     rows = static_cast<size_type_r>(m1.rows());
+        size_type_r     cols = static_cast<size_type_r>(m1.columns());
+        result_type		mr;
+
+        if constexpr (detail::reshapable_matrix_engine<engine_type>)
+        {
+            mr.resize(rows, cols);
+        }
+        else if constexpr (detail::row_reshapable_matrix_engine<engine_type>)
+        {
+            mr.resize_rows(rows);
+        }
+        else if constexpr (detail::column_reshapable_matrix_engine<engine_type>)
+        {
+            mr.resize_columns(cols);
+        }
+
+        if constexpr (small_fixed_size_engine<engine_type>)
+        {
+            fixed_size_kernel_for<engine_type>::multiply_scalar_right(mr, m1, s2);
+            return mr;
+        }
+
+        size_type_r     ir = 0;
+        size_type_1     i1 = 0;
+
+        for (;  ir < rows;  ++ir, ++i1)
+        {
+            size_type_r     jr = 0;
+            size_type_1     j1 = 0;
+
+            for (;  jr < cols;  ++jr, ++j1)
+            {
+                mr(ir, jr) = m1(i1, j1) * s2;
+            }
+        }
+
+        return mr;
+    }
+};
+
+
+//==================================================================================================
+//                      **** PARALLEL MULTIPLICATION ARITHMETIC TRAITS ****
+//==================================================================================================
+//
+//- The parallel multiplication arithmetic traits are used by `parallel_matrix_operation_traits`.
+//  They compute matrix/matrix products on several threads when the engines permit use of the
+//  packed kernel, and otherwise defer to the standard multiplication arithmetic traits.  Products
+//  having a vector operand are left to the GEMV kernel, being limited by memory bandwidth.
+//
+template<class COTR, class OP1, class OP2>
+struct parallel_multiplication_arithmetic_traits
+:   public multiplication_arithmetic_traits<COTR, OP1, OP2>
+{};
+
+template<class COTR, class ET1, class COT1, class ET2, class COT2>
+struct parallel_multiplication_arithmetic_traits<COTR, matrix<ET1, COT1>, matrix<ET2, COT2>>
+:   public multiplication_arithmetic_traits<COTR, matrix<ET1, COT1>, matrix<ET2, COT2>>
+{
+  private:
+    using base_type = multiplication_arithmetic_traits<COTR, matrix<ET1, COT1>, matrix<ET2, COT2>>;
+
+  public:
+    using element_type = typename base_type::element_type;
+    using engine_type  = typename base_type::engine_type;
+    using result_type  = typename base_type::result_type;
+
+    static constexpr result_type
+    multiply(matrix<ET1, COT1> const& m1, matrix<ET2, COT2> const& m2)
+    {
+        using engine_type_1 = typename matrix<ET1, COT1>::engine_type;
+        using engine_type_2 = typename matrix<ET2, COT2>::engine_type;
+        using kernel_type   = gemm_kernel<element_type>;
+
+        if constexpr (gemm_engines<engine_type, engine_type_1, engine_type_2>  and
+                      not (column_vector_engine<engine_type_2>  or  row_vector_engine<engine_type_1>))
+        {
+            size_t const    rows  = static_cast<size_t>(m1.rows());
+            size_t const    cols  = static_cast<size_t>(m2.columns());
+            size_t const    inner = static_cast<size_t>(m1.columns());
+
+            if (not std::is_constant_evaluated()  &&
+                rows * cols * inner >= kernel_type::blocking_traits::min_thread_work)
+            {
+                result_type     mr;
+
+                if constexpr (detail::reshapable_matrix_engine<engine_type>)
+                {
+                    mr.resize(rows, cols);
+                }
+                else if constexpr (detail::row_reshapable_matrix_engine<engine_type>)
+                {
+                    mr.resize_rows(rows);
+                }
+                else if constexpr (detail::column_reshapable_matrix_engine<engine_type>)
+                {
+                    mr.resize_columns(cols);
+                }
+
+                kernel_type::parallel_multiply(element_type{1},
+                                               make_dense_operand(m1.span()),
+                                               make_dense_operand(m2.span()),
+                                               element_type{},
+                                               make_dense_operand(mr.span()),
+                                               std::max(std::thread::hardware_concurrency(), 1u));
+                return mr;
+            }
+        }
+
+        return base_type::multiply(m1, m2);
+    }
+};
+
+
+//==================================================================================================
+//                  **** STRASSEN-WINOGRAD MULTIPLICATION ARITHMETIC TRAITS ****
+//==================================================================================================
+//
+//- The Strassen-Winograd multiplication arithmetic traits are used by
+//  `strassen_matrix_operation_traits<Cutoff>`.  They compute products of square matrices of
+//  floating-point elements whose size exceeds Cutoff by the Strassen-Winograd kernel, provided
+//  the engines permit use of the dense kernels.  All other products are computed by the
+//  standard multiplication arithmetic traits.
+//
+template<class COTR, class OP1, class OP2, size_t Cutoff>
+struct strassen_multiplication_arithmetic_traits
+:   public multiplication_arithmetic_traits<COTR, OP1, OP2>
+{};
+
+template<class COTR, class ET1, class COT1, class ET2, class COT2, size_t Cutoff>
+struct strassen_multiplication_arithmetic_traits<COTR, matrix<ET1, COT1>, matrix<ET2, COT2>, Cutoff>
+:   public multiplication_arithmetic_traits<COTR, matrix<ET1, COT1>, matrix<ET2, COT2>>
+{
+  private:
+    using base_type = multiplication_arithmetic_traits<COTR, matrix<ET1, COT1>, matrix<ET2, COT2>>;
+
+  public:
+    using element_type = typename base_type::element_type;
+    using engine_type  = typename base_type::engine_type;
+    using result_type  = typename base_type::result_type;
+
+    static constexpr result_type
+    multiply(matrix<ET1, COT1> const& m1, matrix<ET2, COT2> const& m2)
+    {
+        using engine_type_1 = typename matrix<ET1, COT1>::engine_type;
+        using engine_type_2 = typename matrix<ET2, COT2>::engine_type;
+
+        if constexpr (gemm_engines<engine_type, engine_type_1, engine_type_2>  and
+                      std::is_floating_point_v<element_type>  and
+                      not (column_vector_engine<engine_type_2>  or  row_vector_engine<engine_type_1>))
+        {
+            size_t const    rows  = static_cast<size_t>(m1.rows());
+            size_t const    cols  = static_cast<size_t>(m2.columns());
+            size_t const    inner = static_cast<size_t>(m1.columns());
+
+            if (not std::is_constant_evaluated()  &&
+                rows > Cutoff  &&  rows == cols  &&  rows == inner)
+            {
+                result_type     mr;
+
+                if constexpr (detail::reshapable_matrix_engine<engine_type>)
+                {
+                    mr.resize(rows, cols);
+                }
+                else if constexpr (detail::row_reshapable_matrix_engine<engine_type>)
+                {
+                    mr.resize_rows(rows);
+                }
+                else if constexpr (detail::column_reshapable_matrix_engine<engine_type>)
+                {
+                    mr.resize_columns(cols);
+                }
+
+                strassen_kernel<element_type>::multiply(make_dense_operand(m1.span()),
+                                                        make_dense_operand(m2.span()),
+                                                        make_dense_operand(mr.span()),
+                                                        Cutoff);
+                return mr;
+            }
+        }
+
+        return base_type::multiply(m1, m2);
+    }
+};
+
+
+//==================================================================================================
+//                      **** COMPLEX 3M MULTIPLICATION ARITHMETIC TRAITS ****
+//==================================================================================================
+//
+//- The complex 3M multiplication arithmetic traits are used by `complex_3m_matrix_operation_traits`.
+//  They compute matrix/matrix products of complex elements by the three_m algorithm of the
+//  complex GEMM kernel, and defer all other products to the standard multiplication traits.
+//
+template<class COTR, class OP1, class OP2>
+struct complex_3m_multiplication_arithmetic_traits
+:   public multiplication_arithmetic_traits<COTR, OP1, OP2>
+{};
+
+template<class COTR, class ET1, class COT1, class ET2, class COT2>
+struct complex_3m_multiplication_arithmetic_traits<COTR, matrix<ET1, COT1>, matrix<ET2, COT2>>
+:   public multiplication_arithmetic_traits<COTR, matrix<ET1, COT1>, matrix<ET2, COT2>>
+{
+  private:
+    using base_type = multiplication_arithmetic_traits<COTR, matrix<ET1, COT1>, matrix<ET2, COT2>>;
+
+  public:
+    using element_type = typename base_type::element_type;
+    using engine_type  = typename base_type::engine_type;
+    using result_type  = typename base_type::result_type;
+
+    static constexpr result_type
+    multiply(matrix<ET1, COT1> const& m1, matrix<ET2, COT2> const& m2)
+    {
+        using engine_type_1 = typename matrix<ET1, COT1>::engine_type;
+        using engine_type_2 = typename matrix<ET2, COT2>::engine_type;
+
+        if constexpr (complex_gemm_engines<engine_type, engine_type_1, engine_type_2>  and
+                      not (column_vector_engine<engine_type_2>  or  row_vector_engine<engine_type_1>))
+        {
+            using kernel_type = split_complex_gemm_kernel<element_type>;
+
+            size_t const    rows  = static_cast<size_t>(m1.rows());
+            size_t const    cols  = static_cast<size_t>(m2.columns());
+            size_t const    inner = static_cast<size_t>(m1.columns());
+
+            if (not std::is_constant_evaluated()  &&  rows * cols * inner >= kernel_type::min_work)
+            {
+                result_type     mr;
+
+                if constexpr (detail::reshapable_matrix_engine<engine_type>)
+                {
+                    mr.resize(rows, cols);
+                }
+                else if constexpr (detail::row_reshapable_matrix_engine<engine_type>)
+                {
+                    mr.resize_rows(rows);
+                }
+                else if constexpr (detail::column_reshapable_matrix_engine<engine_type>)
+                {
+                    mr.resize_columns(cols);
+                }
+
+                kernel_type::multiply(element_type{1},
+                                      make_view_operand(m1.span()),
+                                      make_view_operand(m2.span()),
+                                      element_type{},
+                                      make_dense_operand(mr.span()),
+                                      complex_gemm_algorithm::three_m);
+                return mr;
+            }
+        }
+
+        return base_type::multiply(m1, m2);
+    }
+};
+
+
+//==================================================================================================
+//                       **** LAZY MULTIPLICATION ARITHMETIC TRAITS ****
+//==================================================================================================
+//
+//- The lazy multiplication arithmetic traits are used by `lazy_matrix_operation_traits`.  The
+//  products of a matrix and a scalar are returned as expression engines.  Since each element of
+//  a matrix/matrix product depends on a whole row and column of its operands, any operand that
+//  is an expression is first evaluated, once, into its owning engine type; the product is then
+//  computed by the standard traits, so that it may use the dense kernels.
+//
+template<class COTR, class OP1, class OP2>
+struct lazy_multiplication_arithmetic_traits
+:   public multiplication_arithmetic_traits<COTR, OP1, OP2>
+{};
+
+template<class COTR, class ET1, class COT1, class ET2, class COT2>
+struct lazy_multiplication_arithmetic_traits<COTR, matrix<ET1, COT1>, matrix<ET2, COT2>>
+{
+  private:
+    template<class ET>
+    using operand_engine_t = conditional_t<is_matrix_expression_engine_v<ET>,
+                                           get_owning_engine_type_t<ET>, ET>;
+
+    using operand_type_1 = matrix<operand_engine_t<ET1>, COT1>;
+    using operand_type_2 = matrix<operand_engine_t<ET2>, COT2>;
+    using eager_traits   = multiplication_arithmetic_traits<COTR, operand_type_1, operand_type_2>;
+
+    template<class ET, class COT>
+    static constexpr decltype(auto)
+    evaluate(matrix<ET, COT> const& m)
+    {
+        if constexpr (is_matrix_expression_engine_v<ET>)
+        {
+            return matrix<get_owning_engine_type_t<ET>, COT>(m);
+        }
+        else
+        {
+            return (m);
+        }
+    }
+
+  public:
+    using element_type = typename eager_traits::element_type;
+    using engine_type  = typename eager_traits::engine_type;
+    using result_type  = typename eager_traits::result_type;
+
+    static constexpr result_type
+    multiply(matrix<ET1, COT1> const& m1, matrix<ET2, COT2> const& m2)
+    {
+        return eager_traits::multiply(evaluate(m1), evaluate(m2));
+    }
+};
+
+template<class COTR, class S1, class ET2, class COT2>
+struct lazy_multiplication_arithmetic_traits<COTR, S1, matrix<ET2, COT2>>
+{
+  private:
+    using eager_traits = multiplication_arithmetic_traits<COTR, S1, matrix<ET2, COT2>>;
+
+  public:
+    using element_type = typename eager_traits::element_type;
+    using engine_type  = matrix_expression_engine<typename eager_traits::engine_type,
+                                                  expression_multiply, matrix_scalar_engine<S1>, ET2>;
+    using result_type  = matrix<engine_type, COTR>;
+
+    static constexpr result_type
+    multiply(S1 const& s1, matrix<ET2, COT2> const& m2)
+    {
+        result_type     mr;
+
+        mr.engine() = engine_type(s1, m2.engine());
+        return mr;
+    }
+};
+
+template<class COTR, class ET1, class COT1, class S2>
+struct lazy_multiplication_arithmetic_traits<COTR, matrix<ET1, COT1>, S2>
+{
+  private:
+    using eager_traits = multiplication_arithmetic_traits<COTR, matrix<ET1, COT1>, S2>;
+
+  public:
+    using element_type = typename eager_traits::element_type;
+    using engine_type  = matrix_expression_engine<typename eager_traits::engine_type,
+                                                  expression_multiply, ET1, matrix_scalar_engine<S2>>;
+    using result_type  = matrix<engine_type, COTR>;
+
+    static constexpr result_type
+    multiply(matrix<ET1, COT1> const& m1, S2 const& s2)
+    {
+        result_type     mr;
+
+        mr.engine() = engine_type(m1.engine(), s2);
+        return mr;
+    }
+};
+
 }       //- namespace detail
 }       //- STD_LA namespace
 #endif  //- LINEAR_ALGEBRA_OP_TRAITS_MULTIPLICATION_HPP_DEFINED
@@ -229,6 +229,37 @@ struct subtraction_arithmetic_traits<COTR, matrix<ET1, COT1>, matrix<ET2, COT2>>
         {
             mr.resize(rows, cols);
         }
+        else if constexpr (detail::row_reshapable_matrix_engine<engine_type>)
+        {
+            mr.resize_rows(rows);
+        }
+        else if constexpr (detail::column_reshapable_matrix_engine<engine_type>)
+        {
+            mr.resize_columns(cols);
+        }
+
+        if constexpr (small_fixed_size_engine<engine_type>)
+        {
+            fixed_size_kernel_for<engine_type>::subtract(mr, m1, m2);
+            return mr;
+        }
+
+        //- Dense operands, and transpose and negation views of them, are read through their
+        //  spans by the element-wise kernel, which applies the views' negations.  The
+        //  difference A - B is computed as A + (-B), which is the same in every case.
+        //
+        if constexpr (view_addition_engines<engine_type, engine_type_1, engine_type_2>)
+        {
+            if (not std::is_constant_evaluated())
+            {
+                auto const  a = make_view_operand(m1.span());
+                auto const  b = make_view_operand(m2.span());
+
+                gemv_kernel<element_type>::add(a.op, a.negate, b.op, not b.negate,
+                                               make_dense_operand(mr.span()));
+                return mr;
+            }
+        }
 
         size_type_r    ir = 0;
         size_type_1    i1 = 0;
@@ -250,6 +281,41 @@ struct subtraction_arithmetic_traits<COTR, matrix<ET1, COT1>, matrix<ET2, COT2>>
     }
 };
 
+
+//==================================================================================================
+//                        **** LAZY SUBTRACTION ARITHMETIC TRAITS ****
+//==================================================================================================
+//
+//- The lazy subtraction arithmetic traits are used by `lazy_matrix_operation_traits`.  Like
+//  the lazy addition traits, they return an expression engine instead of a computed difference.
+//
+template<class COTR, class OP1, class OP2>
+struct lazy_subtraction_arithmetic_traits
+:   public subtraction_arithmetic_traits<COTR, OP1, OP2>
+{};
+
+template<class COTR, class ET1, class COT1, class ET2, class COT2>
+struct lazy_subtraction_arithmetic_traits<COTR, matrix<ET1, COT1>, matrix<ET2, COT2>>
+{
+  private:
+    using eager_traits = subtraction_arithmetic_traits<COTR, matrix<ET1, COT1>, matrix<ET2, COT2>>;
+
+  public:
+    using element_type = typename eager_traits::element_type;
+    using engine_type  = matrix_expression_engine<typename eager_traits::engine_type,
+                                                  expression_subtract, ET1, ET2>;
+    using result_type  = matrix<engine_type, COTR>;
+
+    static constexpr result_type
+    subtract(matrix<ET1, COT1> const& m1, matrix<ET2, COT2> const& m2)
+    {
+        result_type     mr;
+
+        mr.engine() = engine_type(m1.engine(), m2.engine());
+        return mr;
+    }
+};
+
 }       //- namespace detail
 }       //- STD_LA namespace
 #endif  //- LINEAR_ALGEBRA_OP_TRAITS_SUBTRACTION_HPP_DEFINED
@@ -44,6 +44,113 @@ struct matrix_operation_traits_selector<COT1, COT1>
 };
 
 
+//--------------------------------------------------------------------------------------------------
+//  Class:      parallel_matrix_operation_traits
+//
+//  This operation traits type may be used as the COT template argument of a matrix type, or
+//  selected by a specialization of matrix_operation_traits_selector, to have large matrix/matrix
+//  products computed on several threads.  The result is partitioned into tiles, one per thread,
+//  and the number of threads is limited by both the hardware concurrency and the size of the
+//  product, so that small products are still computed on the calling thread.  All other
+//  operations are performed by the library's default traits.
+//--------------------------------------------------------------------------------------------------
+//
+struct parallel_matrix_operation_traits
+{
+    template<class OT, class OP1, class OP2>
+    using multiplication_arithmetic_traits = detail::parallel_multiplication_arithmetic_traits<OT, OP1, OP2>;
+};
+
+
+//--------------------------------------------------------------------------------------------------
+//  Class Template:     strassen_matrix_operation_traits<Cutoff>
+//
+//  This operation traits type may be used as the COT template argument of a matrix type, or
+//  selected by a specialization of matrix_operation_traits_selector, to have products of square
+//  floating-point matrices larger than Cutoff x Cutoff computed by the Strassen-Winograd
+//  algorithm, which recurses on half-size blocks until they are no larger than Cutoff, and then
+//  uses the packed kernel.  For very large matrices this performs substantially fewer
+//  operations; however, the results are rounded differently, and the worst-case error is
+//  larger, than with the conventional product.  All other operations are performed by the
+//  library's default traits.
+//--------------------------------------------------------------------------------------------------
+//
+template<size_t Cutoff = 1024>
+struct strassen_matrix_operation_traits
+{
+    template<class OT, class OP1, class OP2>
+    using multiplication_arithmetic_traits =
+        detail::strassen_multiplication_arithmetic_traits<OT, OP1, OP2, Cutoff>;
+};
+
+
+//--------------------------------------------------------------------------------------------------
+//  Class:      complex_3m_matrix_operation_traits
+//
+//  This operation traits type may be used as the COT template argument of a matrix type, or
+//  selected by a specialization of matrix_operation_traits_selector, to have products of complex
+//  matrices computed with three real matrix products instead of four.  This saves a quarter of
+//  the arithmetic of large products, at the cost of a larger error in the imaginary parts of
+//  the result when they are small relative to the real parts.  All other operations are
+//  performed by the library's default traits.
+//--------------------------------------------------------------------------------------------------
+//
+struct complex_3m_matrix_operation_traits
+{
+    template<class OT, class OP1, class OP2>
+    using multiplication_arithmetic_traits =
+        detail::complex_3m_multiplication_arithmetic_traits<OT, OP1, OP2>;
+};
+
+
+//--------------------------------------------------------------------------------------------------
+//  Class:      wide_accumulation_matrix_operation_traits
+//
+//  This operation traits type may be used as the COT template argument of a matrix type, or
+//  selected by a specialization of matrix_operation_traits_selector, to have the sums formed by
+//  matrix products of float (or complex<float>) elements accumulated in double (or complex<
+//  double>), which greatly reduces the rounding error of long sums while storing the operands
+//  and result at single precision.  It serves also as an example of naming an accumulator type
+//  in custom element traits, such as float for a 16-bit floating-point element type.  All other
+//  operations are performed by the library's default traits.
+//--------------------------------------------------------------------------------------------------
+//
+struct wide_accumulation_matrix_operation_traits
+{
+    template<class OT, class T1, class T2>
+    using multiplication_element_traits = detail::wide_multiplication_element_traits<OT, T1, T2>;
+};
+
+
+//--------------------------------------------------------------------------------------------------
+//  Class:      lazy_matrix_operation_traits
+//
+//  This operation traits type may be used as the COT template argument of a matrix type, or
+//  selected by a specialization of matrix_operation_traits_selector, to have the element-wise
+//  operators (matrix addition and subtraction, and multiplication and division by a scalar)
+//  return expressions instead of computed matrices.  An expression is a matrix whose engine
+//  computes each element on demand, so that A + B - 2.0*C is evaluated in a single pass, with
+//  no intermediate matrices, when it is assigned to a matrix or used as an operand of a
+//  matrix/matrix product.  Like views, expressions refer to their operands, and should be
+//  evaluated before those operands are destroyed.
+//--------------------------------------------------------------------------------------------------
+//
+struct lazy_matrix_operation_traits
+{
+    template<class OT, class OP1, class OP2>
+    using addition_arithmetic_traits = detail::lazy_addition_arithmetic_traits<OT, OP1, OP2>;
+
+    template<class OT, class OP1, class OP2>
+    using subtraction_arithmetic_traits = detail::lazy_subtraction_arithmetic_traits<OT, OP1, OP2>;
+
+    template<class OT, class OP1, class OP2>
+    using multiplication_arithmetic_traits = detail::lazy_multiplication_arithmetic_traits<OT, OP1, OP2>;
+
+    template<class OT, class OP1, class OP2>
+    using division_arithmetic_traits = detail::lazy_division_arithmetic_traits<OT, OP1, OP2>;
+};
+
+
 //- Alias template interface to traits result.
 //
 template<class COT1, class COT2>
@@ -0,0 +1,215 @@
+//==================================================================================================
+//  File:       simd_kernels.hpp
+//
+//  Summary:    This header defines the SIMD kernels for a single instruction set.  It is not meant
+//              to be included directly; simd_support.hpp includes it once per instruction set,
+//              having defined LA_SIMD_ISA as the simd_isa value and LA_SIMD_TARGET as the target
+//              attribute for which the kernels are compiled.  It therefore has no include guard.
+//==================================================================================================
+//
+#if !defined(LA_SIMD_ISA) || !defined(LA_SIMD_TARGET)
+    #error "simd_kernels.hpp must be included by simd_support.hpp"
+#endif
+
+template<>
+struct simd_kernels<LA_SIMD_ISA>
+{
+    static constexpr simd_isa   isa = LA_SIMD_ISA;
+
+    //- The micro-kernel for an MR x NR tile, as described for simd_kernels<ISA>.
+    //
+    template<class T, size_t MV, size_t NR>
+    LA_SIMD_TARGET static void
+    gemm(size_t k, T const* a, T const* b, T* ab)
+    {
+        using scalar = simd_scalar_t<T>;
+        using ops    = simd_ops<isa, scalar>;
+        using vec    = typename ops::vec;
+
+        constexpr size_t    L = ops::lanes;
+        constexpr size_t    N = is_complex_v<T> ? 2 : 1;
+
+        scalar const*   pa = reinterpret_cast<scalar const*>(a);
+        scalar const*   pb = reinterpret_cast<scalar const*>(b);
+        scalar*         pc = reinterpret_cast<scalar*>(ab);
+
+        vec     cr[NR][MV];
+        vec     ci[NR][MV];
+
+        LA_SIMD_UNROLL
+        for (size_t j = 0;  j < NR;  ++j)
+            LA_SIMD_UNROLL
+            for (size_t i = 0;  i < MV;  ++i)
+                cr[j][i] = ci[j][i] = ops::zero();
+
+        for (size_t p = 0;  p < k;  ++p, pa += MV*L, pb += NR*N)
+        {
+            vec     av[MV];
+
+            LA_SIMD_UNROLL
+            for (size_t i = 0;  i < MV;  ++i)
+                av[i] = ops::load(pa + i*L);
+
+            LA_SIMD_UNROLL
+            for (size_t j = 0;  j < NR;  ++j)
+            {
+                vec const   br = ops::bcast(pb + j*N);
+
+                LA_SIMD_UNROLL
+                for (size_t i = 0;  i < MV;  ++i)
+                    cr[j][i] = ops::fmadd(av[i], br, cr[j][i]);
+
+                if constexpr (N == 2)
+                {
+                    vec const   bi = ops::bcast(pb + j*N + 1);
+
+                    LA_SIMD_UNROLL
+                    for (size_t i = 0;  i < MV;  ++i)
+                        ci[j][i] = ops::fmadd(av[i], bi, ci[j][i]);
+                }
+            }
+        }
+
+        LA_SIMD_UNROLL
+        for (size_t j = 0;  j < NR;  ++j)
+        {
+            LA_SIMD_UNROLL
+            for (size_t i = 0;  i < MV;  ++i)
+            {
+                if constexpr (N == 2)
+                    ops::store(pc + (j*MV + i)*L, ops::addsub(cr[j][i], ops::swap(ci[j][i])));
+                else
+                    ops::store(pc + (j*MV + i)*L, cr[j][i]);
+            }
+        }
+    }
+
+    //- The dot product and AXPY kernels, as described for simd_vector_kernels<T>.
+    //
+    template<class T>
+    LA_SIMD_TARGET static T
+    dot(size_t n, T const* x, T const* y)
+    {
+        using ops = simd_ops<isa, T>;
+        using vec = typename ops::vec;
+
+        constexpr size_t    L = ops::lanes;
+
+        vec     s0 = ops::zero(), s1 = ops::zero(), s2 = ops::zero(), s3 = ops::zero();
+        size_t  i  = 0;
+
+        for (;  i + 4*L <= n;  i += 4*L)
+        {
+            s0 = ops::fmadd(ops::load(x + i),       ops::load(y + i),       s0);
+            s1 = ops::fmadd(ops::load(x + i + L),   ops::load(y + i + L),   s1);
+            s2 = ops::fmadd(ops::load(x + i + 2*L), ops::load(y + i + 2*L), s2);
+            s3 = ops::fmadd(ops::load(x + i + 3*L), ops::load(y + i + 3*L), s3);
+        }
+        for (;  i + L <= n;  i += L)
+        {
+            s0 = ops::fmadd(ops::load(x + i), ops::load(y + i), s0);
+        }
+
+        T   part[L];
+        T   sum{};
+
+        ops::store(part, ops::add(ops::add(s0, s1), ops::add(s2, s3)));
+
+        LA_SIMD_UNROLL
+        for (size_t j = 0;  j < L;  ++j)
+            sum += part[j];
+
+        for (;  i < n;  ++i)
+            sum += x[i] * y[i];
+
+        return sum;
+    }
+
+    template<class T>
+    LA_SIMD_TARGET static void
+    axpy(size_t n, T alpha, T const* x, T* y)
+    {
+        using ops = simd_ops<isa, T>;
+        using vec = typename ops::vec;
+
+        constexpr size_t    L = ops::lanes;
+
+        vec const   av = ops::bcast(&alpha);
+        size_t      i  = 0;
+
+        for (;  i + 2*L <= n;  i += 2*L)
+        {
+            ops::store(y + i,     ops::fmadd(av, ops::load(x + i),     ops::load(y + i)));
+            ops::store(y + i + L, ops::fmadd(av, ops::load(x + i + L), ops::load(y + i + L)));
+        }
+        for (;  i + L <= n;  i += L)
+        {
+            ops::store(y + i, ops::fmadd(av, ops::load(x + i), ops::load(y + i)));
+        }
+        for (;  i < n;  ++i)
+        {
+            y[i] = y[i] + alpha * x[i];
+        }
+    }
+
+    //- The sliced ELLPACK slice kernel, as described for simd_sell_slice_kernel<T, IT, C>.
+    //
+    template<class T, class IT, size_t C>
+    LA_SIMD_TARGET static void
+    sell(sell_operand<T, IT> const& a, size_t s0, size_t s1, T const* x, T* y, size_t incy)
+    {
+        using ops = simd_ops<isa, T>;
+        using vec = typename ops::vec;
+
+        constexpr size_t    L = ops::lanes;
+        constexpr size_t    V = C / L;
+
+        for (size_t s = s0;  s < s1;  ++s)
+        {
+            IT const* const     len   = a.lengths + s*C;
+            size_t const        first = a.slice_begin(s);
+            size_t const        width = (a.slice_end(s) - first) / C;
+            vec                 acc[V];
+            T                   sums[C];
+
+            LA_SIMD_UNROLL
+            for (size_t v = 0;  v < V;  ++v)
+                acc[v] = ops::zero();
+
+            for (size_t p = 0;  p < width;  ++p)
+            {
+                size_t const    k = first + p*C;
+
+                LA_SIMD_UNROLL
+                for (size_t v = 0;  v < V;  ++v)
+                {
+                    acc[v] = ops::fmadd(ops::load(a.values + k + v*L),
+                                        sell_gather(x, a.indices + k + v*L, len + v*L, p), acc[v]);
+                }
+            }
+
+            LA_SIMD_UNROLL
+            for (size_t v = 0;  v < V;  ++v)
+                ops::store(sums + v*L, acc[v]);
+
+            sell_kernel<T, IT, C>::store(a, s, sums, y, incy);
+        }
+    }
+
+  private:
+    //- SSE2 has no gather instruction, and so this is used only for AVX2 and AVX-512.
+    //
+    template<class T, class IT>
+    LA_SIMD_TARGET LA_SIMD_INLINE static typename simd_ops<isa, T>::vec
+    sell_gather(T const* x, IT const* idx, IT const* len, size_t p) noexcept
+    {
+        if constexpr (isa == simd_isa::avx512)
+        {
+            return simd_avx512_sell_gather(x, idx, len, p);
+        }
+        else
+        {
+            return simd_avx2_sell_gather(x, idx, len, p);
+        }
+    }
+};
@@ -0,0 +1,730 @@
+//==================================================================================================
+//  File:       simd_support.hpp
+//
+//  Summary:    This header defines a number of private types and functions that implement the
+//              SSE2, AVX2/FMA and AVX-512 micro-kernels used by the packed GEMM kernel, along
+//              with the run-time detection of which of them the host CPU supports.
+//==================================================================================================
+//
+#ifndef LINEAR_ALGEBRA_SIMD_SUPPORT_HPP_DEFINED
+#define LINEAR_ALGEBRA_SIMD_SUPPORT_HPP_DEFINED
+
+#if defined(LA_SIMD_X86)
+
+//- Each micro-kernel is compiled for its own instruction set, independent of the options used
+//  to compile the rest of the program, and only called if the host CPU supports it.  Helper
+//  functions must be force-inlined into kernels compiled for the same instruction set, and the
+//  loops over the register block fully unrolled so that the accumulators stay in registers.
+//
+#if defined(LA_COMPILER_MS)
+    #define LA_SIMD_INLINE      __forceinline
+    #define LA_TARGET_SSE2
+    #define LA_TARGET_AVX2
+    #define LA_TARGET_AVX512
+    #define LA_SIMD_UNROLL
+#else
+    #define LA_SIMD_INLINE      [[gnu::always_inline]] inline
+    #define LA_TARGET_SSE2      [[gnu::target("sse2")]]
+    #define LA_TARGET_AVX2      [[gnu::target("avx2,fma")]]
+    #define LA_TARGET_AVX512    [[gnu::target("avx512f")]]
+    #define LA_SIMD_UNROLL      _Pragma("GCC unroll 32")
+#endif
+
+namespace STD_LA {
+namespace detail {
+//==================================================================================================
+//  TYPES AND TRAITS DEFINITIONS -- CPU FEATURE DETECTION
+//==================================================================================================
+//--------------------------------------------------------------------------------------------------
+//  Enum:       simd_isa
+//  Class:      cpu_features
+//
+//  These private types describe the instruction sets for which micro-kernels exist, and the
+//  highest of those supported by the host CPU and operating system.  Detection happens once,
+//  the first time it is needed.
+//--------------------------------------------------------------------------------------------------
+//
+enum class simd_isa : int
+{
+    none   = 0,
+    sse2   = 1,
+    avx2   = 2,
+    avx512 = 3
+};
+
+struct cpu_features
+{
+    static simd_isa
+    host_isa() noexcept
+    {
+        static simd_isa const   isa = detect();
+        return isa;
+    }
+
+    static bool
+    supports(simd_isa isa) noexcept
+    {
+        return static_cast<int>(isa) <= static_cast<int>(host_isa());
+    }
+
+  private:
+#if defined(LA_COMPILER_MS)
+    static simd_isa
+    detect() noexcept
+    {
+        int     info[4];
+
+        __cpuid(info, 0);
+        int const   max_leaf = info[0];
+
+        __cpuid(info, 1);
+        bool const  has_sse2    = (info[3] & (1 << 26)) != 0;
+        bool const  has_fma     = (info[2] & (1 << 12)) != 0;
+        bool const  has_osxsave = (info[2] & (1 << 27)) != 0;
+
+        bool    has_avx2    = false;
+        bool    has_avx512f = false;
+
+        if (max_leaf >= 7)
+        {
+            __cpuidex(info, 7, 0);
+            has_avx2    = (info[1] & (1 << 5)) != 0;
+            has_avx512f = (info[1] & (1 << 16)) != 0;
+        }
+
+        //- The OS must save the YMM (and for AVX-512, the opmask and ZMM) state.
+        //
+        unsigned long long const    xcr0 = (has_osxsave) ? _xgetbv(0) : 0;
+        bool const                  os_avx    = (xcr0 & 0x06) == 0x06;
+        bool const                  os_avx512 = (xcr0 & 0xE6) == 0xE6;
+
+        if (has_avx512f  &&  os_avx512) return simd_isa::avx512;
+        if (has_avx2  &&  has_fma  &&  os_avx) return simd_isa::avx2;
+        if (has_sse2) return simd_isa::sse2;
+        return simd_isa::none;
+    }
+#else
+    static simd_isa
+    detect() noexcept
+    {
+        __builtin_cpu_init();
+
+        if (__builtin_cpu_supports("avx512f")) return simd_isa::avx512;
+        if (__builtin_cpu_supports("avx2")  &&  __builtin_cpu_supports("fma")) return simd_isa::avx2;
+        if (__builtin_cpu_supports("sse2")) return simd_isa::sse2;
+        return simd_isa::none;
+    }
+#endif
+};
+
+
+//==================================================================================================
+//  TYPES AND TRAITS DEFINITIONS -- VECTOR OPERATIONS
+//==================================================================================================
+//--------------------------------------------------------------------------------------------------
+//  Class Template:     simd_ops<ISA, T>
+//
+//  This private traits type wraps the handful of intrinsics needed by the micro-kernels for
+//  instruction set ISA and real element type T.  The `swap` and `addsub` members are used to
+//  form complex products from interleaved real and imaginary parts: swap exchanges each pair
+//  of adjacent lanes, and addsub subtracts in even lanes and adds in odd lanes.
+//--------------------------------------------------------------------------------------------------
+//
+template<simd_isa ISA, class T>     struct simd_ops;
+
+template<>
+struct simd_ops<simd_isa::sse2, double>
+{
+    using vec = __m128d;
+    static constexpr size_t     lanes = 2;
+
+    LA_TARGET_SSE2 LA_SIMD_INLINE static vec
+    zero() noexcept { return _mm_setzero_pd(); }
+
+    LA_TARGET_SSE2 LA_SIMD_INLINE static vec
+    load(double const* p) noexcept { return _mm_loadu_pd(p); }
+
+    LA_TARGET_SSE2 LA_SIMD_INLINE static vec
+    bcast(double const* p) noexcept { return _mm_set1_pd(*p); }
+
+    LA_TARGET_SSE2 LA_SIMD_INLINE static void
+    store(double* p, vec v) noexcept { _mm_storeu_pd(p, v); }
+
+    LA_TARGET_SSE2 LA_SIMD_INLINE static vec
+    add(vec a, vec b) noexcept { return _mm_add_pd(a, b); }
+
+    LA_TARGET_SSE2 LA_SIMD_INLINE static vec
+    fmadd(vec a, vec b, vec c) noexcept { return _mm_add_pd(_mm_mul_pd(a, b), c); }
+
+    LA_TARGET_SSE2 LA_SIMD_INLINE static vec
+    swap(vec a) noexcept { return _mm_shuffle_pd(a, a, 0x1); }
+
+    LA_TARGET_SSE2 LA_SIMD_INLINE static vec
+    addsub(vec a, vec b) noexcept { return _mm_add_pd(a, _mm_xor_pd(b, _mm_set_pd(0.0, -0.0))); }
+};
+
+template<>
+struct simd_ops<simd_isa::sse2, float>
+{
+    using vec = __m128;
+    static constexpr size_t     lanes = 4;
+
+    LA_TARGET_SSE2 LA_SIMD_INLINE static vec
+    zero() noexcept { return _mm_setzero_ps(); }
+
+    LA_TARGET_SSE2 LA_SIMD_INLINE static vec
+    load(float const* p) noexcept { return _mm_loadu_ps(p); }
+
+    LA_TARGET_SSE2 LA_SIMD_INLINE static vec
+    bcast(float const* p) noexcept { return _mm_set1_ps(*p); }
+
+    LA_TARGET_SSE2 LA_SIMD_INLINE static void
+    store(float* p, vec v) noexcept { _mm_storeu_ps(p, v); }
+
+    LA_TARGET_SSE2 LA_SIMD_INLINE static vec
+    add(vec a, vec b) noexcept { return _mm_add_ps(a, b); }
+
+    LA_TARGET_SSE2 LA_SIMD_INLINE static vec
+    fmadd(vec a, vec b, vec c) noexcept { return _mm_add_ps(_mm_mul_ps(a, b), c); }
+
+    LA_TARGET_SSE2 LA_SIMD_INLINE static vec
+    swap(vec a) noexcept { return _mm_shuffle_ps(a, a, 0xB1); }
+
+    LA_TARGET_SSE2 LA_SIMD_INLINE static vec
+    addsub(vec a, vec b) noexcept { return _mm_add_ps(a, _mm_xor_ps(b, _mm_set_ps(0.0f, -0.0f, 0.0f, -0.0f))); }
+};
+
+template<>
+struct simd_ops<simd_isa::avx2, double>
+{
+    using vec = __m256d;
+    static constexpr size_t     lanes = 4;
+
+    LA_TARGET_AVX2 LA_SIMD_INLINE static vec
+    zero() noexcept { return _mm256_setzero_pd(); }
+
+    LA_TARGET_AVX2 LA_SIMD_INLINE static vec
+    load(double const* p) noexcept { return _mm256_loadu_pd(p); }
+
+    LA_TARGET_AVX2 LA_SIMD_INLINE static vec
+    bcast(double const* p) noexcept { return _mm256_broadcast_sd(p); }
+
+    LA_TARGET_AVX2 LA_SIMD_INLINE static void
+    store(double* p, vec v) noexcept { _mm256_storeu_pd(p, v); }
+
+    LA_TARGET_AVX2 LA_SIMD_INLINE static vec
+    add(vec a, vec b) noexcept { return _mm256_add_pd(a, b); }
+
+    LA_TARGET_AVX2 LA_SIMD_INLINE static vec
+    fmadd(vec a, vec b, vec c) noexcept { return _mm256_fmadd_pd(a, b, c); }
+
+    LA_TARGET_AVX2 LA_SIMD_INLINE static vec
+    swap(vec a) noexcept { return _mm256_permute_pd(a, 0x5); }
+
+    LA_TARGET_AVX2 LA_SIMD_INLINE static vec
+    addsub(vec a, vec b) noexcept { return _mm256_addsub_pd(a, b); }
+};
+
+template<>
+struct simd_ops<simd_isa::avx2, float>
+{
+    using vec = __m256;
+    static constexpr size_t     lanes = 8;
+
+    LA_TARGET_AVX2 LA_SIMD_INLINE static vec
+    zero() noexcept { return _mm256_setzero_ps(); }
+
+    LA_TARGET_AVX2 LA_SIMD_INLINE static vec
+    load(float const* p) noexcept { return _mm256_loadu_ps(p); }
+
+    LA_TARGET_AVX2 LA_SIMD_INLINE static vec
+    bcast(float const* p) noexcept { return _mm256_broadcast_ss(p); }
+
+    LA_TARGET_AVX2 LA_SIMD_INLINE static void
+    store(float* p, vec v) noexcept { _mm256_storeu_ps(p, v); }
+
+    LA_TARGET_AVX2 LA_SIMD_INLINE static vec
+    add(vec a, vec b) noexcept { return _mm256_add_ps(a, b); }
+
+    LA_TARGET_AVX2 LA_SIMD_INLINE static vec
+    fmadd(vec a, vec b, vec c) noexcept { return _mm256_fmadd_ps(a, b, c); }
+
+    LA_TARGET_AVX2 LA_SIMD_INLINE static vec
+    swap(vec a) noexcept { return _mm256_permute_ps(a, 0xB1); }
+
+    LA_TARGET_AVX2 LA_SIMD_INLINE static vec
+    addsub(vec a, vec b) noexcept { return _mm256_addsub_ps(a, b); }
+};
+
+template<>
+struct simd_ops<simd_isa::avx512, double>
+{
+    using vec = __m512d;
+    static constexpr size_t     lanes = 8;
+
+    LA_TARGET_AVX512 LA_SIMD_INLINE static vec
+    zero() noexcept { return _mm512_setzero_pd(); }
+
+    LA_TARGET_AVX512 LA_SIMD_INLINE static vec
+    load(double const* p) noexcept { return _mm512_loadu_pd(p); }
+
+    LA_TARGET_AVX512 LA_SIMD_INLINE static vec
+    bcast(double const* p) noexcept { return _mm512_set1_pd(*p); }
+
+    LA_TARGET_AVX512 LA_SIMD_INLINE static void
+    store(double* p, vec v) noexcept { _mm512_storeu_pd(p, v); }
+
+    LA_TARGET_AVX512 LA_SIMD_INLINE static vec
+    add(vec a, vec b) noexcept { return _mm512_add_pd(a, b); }
+
+    LA_TARGET_AVX512 LA_SIMD_INLINE static vec
+    fmadd(vec a, vec b, vec c) noexcept { return _mm512_fmadd_pd(a, b, c); }
+
+    LA_TARGET_AVX512 LA_SIMD_INLINE static vec
+    swap(vec a) noexcept { return _mm512_shuffle_pd(a, a, 0x55); }
+
+    LA_TARGET_AVX512 LA_SIMD_INLINE static vec
+    addsub(vec a, vec b) noexcept { return _mm512_fmaddsub_pd(_mm512_set1_pd(1.0), a, b); }
+};
+
+template<>
+struct simd_ops<simd_isa::avx512, float>
+{
+    using vec = __m512;
+    static constexpr size_t     lanes = 16;
+
+    LA_TARGET_AVX512 LA_SIMD_INLINE static vec
+    zero() noexcept { return _mm512_setzero_ps(); }
+
+    LA_TARGET_AVX512 LA_SIMD_INLINE static vec
+    load(float const* p) noexcept { return _mm512_loadu_ps(p); }
+
+    LA_TARGET_AVX512 LA_SIMD_INLINE static vec
+    bcast(float const* p) noexcept { return _mm512_set1_ps(*p); }
+
+    LA_TARGET_AVX512 LA_SIMD_INLINE static void
+    store(float* p, vec v) noexcept { _mm512_storeu_ps(p, v); }
+
+    LA_TARGET_AVX512 LA_SIMD_INLINE static vec
+    add(vec a, vec b) noexcept { return _mm512_add_ps(a, b); }
+
+    LA_TARGET_AVX512 LA_SIMD_INLINE static vec
+    fmadd(vec a, vec b, vec c) noexcept { return _mm512_fmadd_ps(a, b, c); }
+
+    LA_TARGET_AVX512 LA_SIMD_INLINE static vec
+    swap(vec a) noexcept { return _mm512_shuffle_ps(a, a, 0xB1); }
+
+    LA_TARGET_AVX512 LA_SIMD_INLINE static vec
+    addsub(vec a, vec b) noexcept { return _mm512_fmaddsub_ps(_mm512_set1_ps(1.0f), a, b); }
+};
+
+
+//--------------------------------------------------------------------------------------------------
+//  Function Templates:     simd_{avx2,avx512}_sell_gather<T, IT>
+//
+//  These private functions are used by the sliced ELLPACK kernels.  Each loads the column indices
+//  of one register of lanes, and gathers the elements of x at them, masked by comparing the
+//  lengths of the rows of those lanes with the step p, so that masked lanes read zero and load
+//  nothing.
+//--------------------------------------------------------------------------------------------------
+//
+template<class T, class IT>
+LA_TARGET_AVX2 LA_SIMD_INLINE typename simd_ops<simd_isa::avx2, T>::vec
+simd_avx2_sell_gather(T const* x, IT const* idx, IT const* len, size_t p) noexcept
+{
+    if constexpr (same_as<T, double>  and  sizeof(IT) == 8)
+    {
+        __m256i const   iv = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(idx));
+        __m256i const   lv = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(len));
+        __m256i const   mv = _mm256_cmpgt_epi64(lv, _mm256_set1_epi64x(static_cast<long long>(p)));
+
+        return _mm256_mask_i64gather_pd(_mm256_setzero_pd(), x, iv, _mm256_castsi256_pd(mv), 8);
+    }
+    else if constexpr (same_as<T, double>)
+    {
+        __m128i const   iv = _mm_loadu_si128(reinterpret_cast<__m128i const*>(idx));
+        __m128i const   lv = _mm_loadu_si128(reinterpret_cast<__m128i const*>(len));
+        __m256i const   mv = _mm256_cvtepi32_epi64(_mm_cmpgt_epi32(lv, _mm_set1_epi32(static_cast<int>(p))));
+
+        return _mm256_mask_i32gather_pd(_mm256_setzero_pd(), x, iv, _mm256_castsi256_pd(mv), 8);
+    }
+    else
+    {
+        __m256i const   iv = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(idx));
+        __m256i const   lv = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(len));
+        __m256i const   mv = _mm256_cmpgt_epi32(lv, _mm256_set1_epi32(static_cast<int>(p)));
+
+        return _mm256_mask_i32gather_ps(_mm256_setzero_ps(), x, iv, _mm256_castsi256_ps(mv), 4);
+    }
+}
+
+template<class T, class IT>
+LA_TARGET_AVX512 LA_SIMD_INLINE typename simd_ops<simd_isa::avx512, T>::vec
+simd_avx512_sell_gather(T const* x, IT const* idx, IT const* len, size_t p) noexcept
+{
+    if constexpr (same_as<T, double>  and  sizeof(IT) == 8)
+    {
+        __m512i const   iv = _mm512_loadu_si512(idx);
+        __m512i const   lv = _mm512_loadu_si512(len);
+        __mmask8 const  mk = _mm512_cmpgt_epi64_mask(lv, _mm512_set1_epi64(static_cast<long long>(p)));
+
+        return _mm512_mask_i64gather_pd(_mm512_setzero_pd(), mk, iv, x, 8);
+    }
+    else if constexpr (same_as<T, double>)
+    {
+        __m256i const   iv = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(idx));
+        __m256i const   lv = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(len));
+        __m256i const   mv = _mm256_cmpgt_epi32(lv, _mm256_set1_epi32(static_cast<int>(p)));
+        __mmask8 const  mk = static_cast<__mmask8>(_mm256_movemask_ps(_mm256_castsi256_ps(mv)));
+
+        return _mm512_mask_i32gather_pd(_mm512_setzero_pd(), mk, iv, x, 8);
+    }
+    else
+    {
+        __m512i const   iv = _mm512_loadu_si512(idx);
+        __m512i const   lv = _mm512_loadu_si512(len);
+        __mmask16 const mk = _mm512_cmpgt_epi32_mask(lv, _mm512_set1_epi32(static_cast<int>(p)));
+
+        return _mm512_mask_i32gather_ps(_mm512_setzero_ps(), mk, iv, x, 4);
+    }
+}
+
+
+//==================================================================================================
+//  TYPES AND TRAITS DEFINITIONS -- MICRO-KERNELS
+//==================================================================================================
+//--------------------------------------------------------------------------------------------------
+//  Class Template:     simd_kernels<ISA>
+//
+//  The specializations of this private type hold the kernels compiled for instruction set ISA.
+//  Each kernel is written once, in simd_kernels.hpp, which is included below once per instruction
+//  set.  A kernel cannot instead be a single force-inlined function template called by a wrapper
+//  per instruction set, because GCC will not inline the target-specific members of
+//  simd_ops<ISA, T> into a template that is not itself compiled for that target.
+//
+//  The micro-kernel, simd_kernels<ISA>::gemm<T, MV, NR>, implements the contract of
+//  gemm_micro_kernel<T> for MR = MV * (lanes / N) and NR, where N is 1 for real T and 2 for
+//  complex T.  Each column of the MR x NR tile is held in MV vector registers.  For each step
+//  along K, the MR elements of packed A are loaded into MV registers, and each element of packed
+//  B is broadcast and multiplied into the corresponding column.
+//
+//  For complex T, the elements are treated as interleaved real and imaginary parts.  The
+//  real and imaginary parts of B are broadcast separately into two sets of accumulators, which
+//  are combined into complex products only once, after the loop over K.
+//--------------------------------------------------------------------------------------------------
+//
+template<class T>
+struct simd_scalar
+{
+    using type = T;
+};
+
+template<class T>
+struct simd_scalar<std::complex<T>>
+{
+    using type = T;
+};
+
+template<class T>
+using simd_scalar_t = typename simd_scalar<T>::type;
+
+//------
+//
+template<simd_isa ISA>   struct simd_kernels;
+
+#define LA_SIMD_ISA         simd_isa::sse2
+#define LA_SIMD_TARGET      LA_TARGET_SSE2
+#include "linear_algebra/simd_kernels.hpp"
+#undef  LA_SIMD_ISA
+#undef  LA_SIMD_TARGET
+
+#define LA_SIMD_ISA         simd_isa::avx2
+#define LA_SIMD_TARGET      LA_TARGET_AVX2
+#include "linear_algebra/simd_kernels.hpp"
+#undef  LA_SIMD_ISA
+#undef  LA_SIMD_TARGET
+
+#define LA_SIMD_ISA         simd_isa::avx512
+#define LA_SIMD_TARGET      LA_TARGET_AVX512
+#include "linear_algebra/simd_kernels.hpp"
+#undef  LA_SIMD_ISA
+#undef  LA_SIMD_TARGET
+
+
+//--------------------------------------------------------------------------------------------------
+//  Class Template:     simd_gemm_micro_kernel_table<T>
+//  Class Template:     simd_gemm_micro_kernel<T>
+//
+//  These private types select the micro-kernel for float, double, complex<float> and
+//  complex<double>, either for a given instruction set or for the host CPU.  The register
+//  blocks are sized to use most of the vector registers (16 for SSE2 and AVX2, 32 for AVX-512)
+//  for accumulators, leaving room for A and B.
+//--------------------------------------------------------------------------------------------------
+//
+template<class T>
+struct simd_gemm_micro_kernel_table
+{
+    using scalar       = simd_scalar_t<T>;
+    using micro_kernel = gemm_micro_kernel<T>;
+
+    static constexpr size_t     N = is_complex_v<T> ? 2 : 1;
+    static constexpr size_t     MV = 2;
+
+    static micro_kernel
+    for_isa(simd_isa isa, micro_kernel const& fallback) noexcept
+    {
+        switch (isa)
+        {
+          case simd_isa::avx512:
+          {
+            constexpr size_t    mr = MV * simd_ops<simd_isa::avx512, scalar>::lanes / N;
+            constexpr size_t    nr = 12 / N;
+            return micro_kernel{mr, nr, &simd_kernels<simd_isa::avx512>::template gemm<T, MV, nr>};
+          }
+          case simd_isa::avx2:
+          {
+            constexpr size_t    mr = MV * simd_ops<simd_isa::avx2, scalar>::lanes / N;
+            constexpr size_t    nr = 6 / N;
+            return micro_kernel{mr, nr, &simd_kernels<simd_isa::avx2>::template gemm<T, MV, nr>};
+          }
+          case simd_isa::sse2:
+          {
+            constexpr size_t    mr = MV * simd_ops<simd_isa::sse2, scalar>::lanes / N;
+            constexpr size_t    nr = 4 / N;
+            return micro_kernel{mr, nr, &simd_kernels<simd_isa::sse2>::template gemm<T, MV, nr>};
+          }
+          default:
+            return fallback;
+        }
+    }
+};
+
+//------
+//
+template<class T>
+requires
+    same_as<T, float> or same_as<T, double> or
+    same_as<T, std::complex<float>> or same_as<T, std::complex<double>>
+struct simd_gemm_micro_kernel<T>
+{
+    static gemm_micro_kernel<T>
+    select(gemm_micro_kernel<T> const& fallback) noexcept
+    {
+        return simd_gemm_micro_kernel_table<T>::for_isa(cpu_features::host_isa(), fallback);
+    }
+};
+
+
+//==================================================================================================
+//  TYPES AND TRAITS DEFINITIONS -- VECTOR KERNELS
+//==================================================================================================
+//--------------------------------------------------------------------------------------------------
+//  Class Template:     simd_vector_kernels<T>
+//
+//  This specialization selects the vector kernels for float and double suited to the host CPU.
+//  The members simd_kernels<ISA>::dot<T> and simd_kernels<ISA>::axpy<T> implement the unit-stride
+//  dot product and AXPY kernels described by vector_kernels<T>.  The dot product keeps four
+//  vector accumulators to hide the latency of the multiply-adds; the accumulators are summed
+//  once, at the end.
+//--------------------------------------------------------------------------------------------------
+//
+template<class T>
+requires
+    same_as<T, float> or same_as<T, double>
+struct simd_vector_kernels<T>
+{
+    static vector_kernels<T>
+    for_isa(simd_isa isa, vector_kernels<T> const& fallback) noexcept
+    {
+        switch (isa)
+        {
+          case simd_isa::avx512:
+            return vector_kernels<T>{&simd_kernels<simd_isa::avx512>::template dot<T>,
+                                     &simd_kernels<simd_isa::avx512>::template axpy<T>};
+          case simd_isa::avx2:
+            return vector_kernels<T>{&simd_kernels<simd_isa::avx2>::template dot<T>,
+                                     &simd_kernels<simd_isa::avx2>::template axpy<T>};
+          case simd_isa::sse2:
+            return vector_kernels<T>{&simd_kernels<simd_isa::sse2>::template dot<T>,
+                                     &simd_kernels<simd_isa::sse2>::template axpy<T>};
+          default:
+            return fallback;
+        }
+    }
+
+    static vector_kernels<T>
+    select(vector_kernels<T> const& fallback) noexcept
+    {
+        return for_isa(cpu_features::host_isa(), fallback);
+    }
+};
+
+
+//==================================================================================================
+//  TYPES AND TRAITS DEFINITIONS -- SLICED ELLPACK KERNELS
+//==================================================================================================
+//--------------------------------------------------------------------------------------------------
+//  Class Template:     simd_sell_slice_kernel<T, IT, C>
+//
+//  This specialization selects the slice kernel suited to the host CPU, for double with 32- or
+//  64-bit indices, and for float with 32-bit indices.  The member function template
+//  simd_kernels<ISA>::sell<T, IT, C> implements the slice kernel described by
+//  sell_slice_kernel<T, IT, C> for C a multiple of the number of lanes, holding each slice in
+//  C / lanes vector accumulators.  An instruction set whose lanes do not divide C falls back to
+//  the next.  SSE2 has no gather instruction, and so no kernel.
+//--------------------------------------------------------------------------------------------------
+//
+template<class T, class IT, size_t C>
+requires
+    (same_as<T, double> and (sizeof(IT) == 4 or sizeof(IT) == 8)) or
+    (same_as<T, float> and sizeof(IT) == 4)
+struct simd_sell_slice_kernel<T, IT, C>
+{
+    static sell_slice_kernel<T, IT, C>
+    for_isa(simd_isa isa, sell_slice_kernel<T, IT, C> const& fallback) noexcept
+    {
+        switch (isa)
+        {
+          case simd_isa::avx512:
+            if constexpr (C % simd_ops<simd_isa::avx512, T>::lanes == 0)
+            {
+                return sell_slice_kernel<T, IT, C>{
+                    &simd_kernels<simd_isa::avx512>::template sell<T, IT, C>};
+            }
+            [[fallthrough]];
+          case simd_isa::avx2:
+            if constexpr (C % simd_ops<simd_isa::avx2, T>::lanes == 0)
+            {
+                return sell_slice_kernel<T, IT, C>{
+                    &simd_kernels<simd_isa::avx2>::template sell<T, IT, C>};
+            }
+            [[fallthrough]];
+          default:
+            return fallback;
+        }
+    }
+
+    static sell_slice_kernel<T, IT, C>
+    select(sell_slice_kernel<T, IT, C> const& fallback) noexcept
+    {
+        return for_isa(cpu_features::host_isa(), fallback);
+    }
+};
+
+
+//==================================================================================================
+//  TYPES AND TRAITS DEFINITIONS -- FIXED-SIZE ROW OPERATIONS
+//==================================================================================================
+//--------------------------------------------------------------------------------------------------
+//  Class Template:     simd_row_ops<T, N>
+//
+//  These specializations describe the SIMD registers that hold a row of N elements of type T
+//  and that the compiler has been told it may use (e.g., by -mavx), so that they may be used
+//  without run-time dispatch by the fixed-size kernels and by batch_element<T, N>.  FMA
+//  instructions are used only where the compiler has been told it may use them, too.
+//--------------------------------------------------------------------------------------------------
+//
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+
+template<>
+struct simd_row_ops<float, 4>
+{
+    static constexpr bool   available = true;
+    using vec = __m128;
+
+    static vec  zero() noexcept                 { return _mm_setzero_ps(); }
+    static vec  load(float const* p) noexcept   { return _mm_loadu_ps(p); }
+    static vec  bcast(float const* p) noexcept  { return _mm_set1_ps(*p); }
+    static void store(float* p, vec v) noexcept { _mm_storeu_ps(p, v); }
+
+    static vec  add(vec a, vec b) noexcept { return _mm_add_ps(a, b); }
+    static vec  sub(vec a, vec b) noexcept { return _mm_sub_ps(a, b); }
+    static vec  mul(vec a, vec b) noexcept { return _mm_mul_ps(a, b); }
+    static vec  div(vec a, vec b) noexcept { return _mm_div_ps(a, b); }
+
+#if defined(__FMA__) || (defined(LA_COMPILER_MS) && defined(__AVX2__))
+    static vec  fmadd(vec a, vec b, vec c) noexcept { return _mm_fmadd_ps(a, b, c); }
+#else
+    static vec  fmadd(vec a, vec b, vec c) noexcept { return _mm_add_ps(c, _mm_mul_ps(a, b)); }
+#endif
+};
+
+template<>
+struct simd_row_ops<double, 2>
+{
+    static constexpr bool   available = true;
+    using vec = __m128d;
+
+    static vec  zero() noexcept                  { return _mm_setzero_pd(); }
+    static vec  load(double const* p) noexcept   { return _mm_loadu_pd(p); }
+    static vec  bcast(double const* p) noexcept  { return _mm_set1_pd(*p); }
+    static void store(double* p, vec v) noexcept { _mm_storeu_pd(p, v); }
+
+    static vec  add(vec a, vec b) noexcept { return _mm_add_pd(a, b); }
+    static vec  sub(vec a, vec b) noexcept { return _mm_sub_pd(a, b); }
+    static vec  mul(vec a, vec b) noexcept { return _mm_mul_pd(a, b); }
+    static vec  div(vec a, vec b) noexcept { return _mm_div_pd(a, b); }
+
+#if defined(__FMA__) || (defined(LA_COMPILER_MS) && defined(__AVX2__))
+    static vec  fmadd(vec a, vec b, vec c) noexcept { return _mm_fmadd_pd(a, b, c); }
+#else
+    static vec  fmadd(vec a, vec b, vec c) noexcept { return _mm_add_pd(c, _mm_mul_pd(a, b)); }
+#endif
+};
+
+#endif
+
+#if defined(__AVX__)
+
+template<>
+struct simd_row_ops<float, 8>
+{
+    static constexpr bool   available = true;
+    using vec = __m256;
+
+    static vec  zero() noexcept                 { return _mm256_setzero_ps(); }
+    static vec  load(float const* p) noexcept   { return _mm256_loadu_ps(p); }
+    static vec  bcast(float const* p) noexcept  { return _mm256_broadcast_ss(p); }
+    static void store(float* p, vec v) noexcept { _mm256_storeu_ps(p, v); }
+
+    static vec  add(vec a, vec b) noexcept { return _mm256_add_ps(a, b); }
+    static vec  sub(vec a, vec b) noexcept { return _mm256_sub_ps(a, b); }
+    static vec  mul(vec a, vec b) noexcept { return _mm256_mul_ps(a, b); }
+    static vec  div(vec a, vec b) noexcept { return _mm256_div_ps(a, b); }
+
+#if defined(__FMA__) || (defined(LA_COMPILER_MS) && defined(__AVX2__))
+    static vec  fmadd(vec a, vec b, vec c) noexcept { return _mm256_fmadd_ps(a, b, c); }
+#else
+    static vec  fmadd(vec a, vec b, vec c) noexcept { return _mm256_add_ps(c, _mm256_mul_ps(a, b)); }
+#endif
+};
+
+template<>
+struct simd_row_ops<double, 4>
+{
+    static constexpr bool   available = true;
+    using vec = __m256d;
+
+    static vec  zero() noexcept                  { return _mm256_setzero_pd(); }
+    static vec  load(double const* p) noexcept   { return _mm256_loadu_pd(p); }
+    static vec  bcast(double const* p) noexcept  { return _mm256_broadcast_sd(p); }
+    static void store(double* p, vec v) noexcept { _mm256_storeu_pd(p, v); }
+
+    static vec  add(vec a, vec b) noexcept { return _mm256_add_pd(a, b); }
+    static vec  sub(vec a, vec b) noexcept { return _mm256_sub_pd(a, b); }
+    static vec  mul(vec a, vec b) noexcept { return _mm256_mul_pd(a, b); }
+    static vec  div(vec a, vec b) noexcept { return _mm256_div_pd(a, b); }
+
+#if defined(__FMA__) || (defined(LA_COMPILER_MS) && defined(__AVX2__))
+    static vec  fmadd(vec a, vec b, vec c) noexcept { return _mm256_fmadd_pd(a, b, c); }
+#else
+    static vec  fmadd(vec a, vec b, vec c) noexcept { return _mm256_add_pd(c, _mm256_mul_pd(a, b)); }
+#endif
+};
+
+#endif
+
+}       //- detail namespace
+}       //- STD_LA namespace
+#endif  //- LA_SIMD_X86
+#endif  //- LINEAR_ALGEBRA_SIMD_SUPPORT_HPP_DEFINED
@@ -0,0 +1,434 @@
+//==================================================================================================
+//  File:       sliced_ellpack_engine.hpp
+//
+//  Summary:    This header defines an owning, read-only engine that stores the non-zero elements
+//              of a sparse matrix in sliced ELLPACK (SELL-C-sigma) form.
+//==================================================================================================
+//
+#ifndef LINEAR_ALGEBRA_SLICED_ELLPACK_ENGINE_HPP_DEFINED
+#define LINEAR_ALGEBRA_SLICED_ELLPACK_ENGINE_HPP_DEFINED
+
+namespace STD_LA {
+namespace detail {
+//--------------------------------------------------------------------------------------------------
+//  Concept:    valid_sliced_ellpack_engine_arguments<T, IT, AT, C>
+//
+//  This private concept is used to validate the template arguments of sliced_ellpack_engine.  The
+//  index type must be a non-boolean integral type, the allocator must be an allocator of T, and
+//  the slice height must be positive.
+//--------------------------------------------------------------------------------------------------
+//
+template<class T, class IT, class AT, size_t C>
+concept valid_sliced_ellpack_engine_arguments =
+    (std::is_integral_v<IT> and not same_as<IT, bool>)
+    and
+    valid_allocator_interface<T, AT>
+    and
+    (C > 0);
+
+//- The default slice height is the number of elements of type T in a 64-byte vector register,
+//  which is that of AVX-512, and a multiple of that of AVX2 and SSE2.
+//
+template<class T>
+inline constexpr size_t     default_slice_height = (sizeof(T) < 64) ? 64 / sizeof(T) : 1;
+
+}       //- detail namespace
+
+
+//--------------------------------------------------------------------------------------------------
+//  Class Template:     sliced_ellpack_engine<T, IT, AT, C>
+//
+//  This class template implements an owning engine for use by class template matrix<ET, OT>.
+//  It stores a sparse matrix in the SELL-C-sigma form of Kreutzer et al., in which the rows are
+//  grouped into slices of C consecutive rows, and each slice is stored as a dense C x W block,
+//  where W is the length of its longest row; shorter rows are padded with zeros.  The blocks are
+//  stored column by column, so that the k-th elements of the C rows of a slice are adjacent, and
+//  a product with the matrix advances C rows at once, one per SIMD lane.  C should therefore be a
+//  multiple of the number of elements of type T in a vector register; the default is that of
+//  AVX-512.
+//
+//  To reduce the padding, the rows are first sorted by decreasing length within windows of sigma
+//  rows, the sorting scope, which is given at construction and is either 1 (no sorting) or a
+//  multiple of C.  Sorting within windows, rather than over the whole matrix, keeps each row
+//  near its original position, and so preserves much of the locality of accesses to the vector
+//  operand of a product.  The matrix is described by six arrays:
+//
+//      - slice offsets, of length slices + 1, where the block of slice s occupies the positions
+//        [offsets[s], offsets[s+1]) of the column index and value arrays;
+//      - row lengths, of length slices * C, the number of non-zero elements of the row in each
+//        slot, which is zero for the slots that pad the last slice;
+//      - the row permutation, of length rows(), the row stored in each slot;
+//      - column indices and values, in which the k-th element of the row in slot l of slice s is
+//        at position offsets[s] + k*C + l, with column indices strictly increasing along a row;
+//        padding elements have column index zero and value zero.
+//
+//  Indices are stored as type IT, as for sparse_matrix_engine.  Elements are read by value, and
+//  those not stored read as zero; the engine is not writable.  A matrix of this engine is
+//  constructed by converting a sparse_matrix_engine in compressed sparse row form, or by
+//  compressing the non-zero elements of another matrix.
+//--------------------------------------------------------------------------------------------------
+//
+template<class T, class IT = size_t, class AT = std::allocator<T>,
+         size_t C = detail::default_slice_height<T>>
+requires
+    detail::valid_sliced_ellpack_engine_arguments<T, IT, AT, C>
+class sliced_ellpack_engine
+{
+    using index_allocator_type = typename std::allocator_traits<AT>::template rebind_alloc<IT>;
+
+  public:
+    using element_type       = T;
+    using index_type         = IT;
+    using allocator_type     = AT;
+    using reference          = element_type;
+    using const_reference    = element_type;
+    using size_type          = size_t;
+    using index_array_type   = std::vector<IT, index_allocator_type>;
+    using element_array_type = std::vector<T, AT>;
+
+    static constexpr size_type  slice_height          = C;
+    static constexpr size_type  default_sorting_scope = 32 * C;
+
+  public:
+    ~sliced_ellpack_engine() = default;
+
+    //- Construct / assign.
+    //
+    constexpr sliced_ellpack_engine()
+    :   m_rows(0), m_cols(0), m_sigma(1), m_nonzeros(0)
+    ,   m_offsets(1, IT{0}), m_lengths(), m_permutation(), m_slots(), m_indices(), m_values()
+    {}
+    constexpr sliced_ellpack_engine(sliced_ellpack_engine&&) noexcept = default;
+    constexpr sliced_ellpack_engine(sliced_ellpack_engine const&) = default;
+
+    constexpr sliced_ellpack_engine&    operator =(sliced_ellpack_engine&&) noexcept = default;
+    constexpr sliced_ellpack_engine&    operator =(sliced_ellpack_engine const&) = default;
+
+    //- Construction of a matrix of the given extents having no non-zero elements.
+    //
+    constexpr
+    sliced_ellpack_engine(size_type rows, size_type cols)
+    :   m_rows(rows), m_cols(cols), m_sigma(1), m_nonzeros(0)
+    ,   m_offsets(slice_count(rows) + 1, IT{0})
+    ,   m_lengths(slice_count(rows) * C, IT{0})
+    ,   m_permutation(rows)
+    ,   m_slots(), m_indices(), m_values()
+    {
+        verify_index(std::max(rows, cols));
+        std::iota(m_permutation.begin(), m_permutation.end(), IT{0});
+        make_slots();
+    }
+
+    //- Construction by conversion from compressed sparse row form, sorting the rows within
+    //  windows of sigma rows.
+    //
+    template<class T2, class IT2, class AT2>
+    constexpr explicit
+    sliced_ellpack_engine(sparse_matrix_engine<T2, IT2, AT2, matrix_layout::row_major> const& rhs,
+                          size_type sigma = default_sorting_scope)
+    requires
+        detail::convertible_from<element_type, T2>
+    :   m_rows(rhs.rows())
+    ,   m_cols(rhs.columns())
+    ,   m_sigma(sigma)
+    ,   m_nonzeros(rhs.nonzeros())
+    ,   m_offsets()
+    ,   m_lengths()
+    ,   m_permutation()
+    ,   m_slots()
+    ,   m_indices()
+    ,   m_values()
+    {
+        verify_sorting_scope(sigma);
+        verify_index(std::max(m_rows, m_cols));
+        convert(rhs.row_offsets(), rhs.column_indices(), rhs.values());
+    }
+
+    //- Construction by compressing the non-zero elements of another engine.
+    //
+    template<class ET2>
+    constexpr explicit
+    sliced_ellpack_engine(ET2 const& rhs, size_type sigma = default_sorting_scope)
+    requires
+        detail::readable_matrix_engine<ET2>
+        and
+        detail::convertible_from<element_type, typename ET2::element_type>
+    :   sliced_ellpack_engine(sparse_matrix_engine<T, IT, AT>(rhs), sigma)
+    {}
+
+    //- Size and capacity reporting.
+    //
+    constexpr size_type
+    columns() const noexcept
+    {
+        return m_cols;
+    }
+
+    constexpr size_type
+    rows() const noexcept
+    {
+        return m_rows;
+    }
+
+    constexpr size_type
+    size() const noexcept
+    {
+        return m_rows * m_cols;
+    }
+
+    constexpr size_type
+    column_capacity() const noexcept
+    {
+        return m_cols;
+    }
+
+    constexpr size_type
+    row_capacity() const noexcept
+    {
+        return m_rows;
+    }
+
+    constexpr size_type
+    capacity() const noexcept
+    {
+        return m_rows * m_cols;
+    }
+
+    constexpr size_type
+    nonzeros() const noexcept
+    {
+        return m_nonzeros;
+    }
+
+    constexpr size_type
+    slices() const noexcept
+    {
+        return m_offsets.size() - 1;
+    }
+
+    constexpr size_type
+    sorting_scope() const noexcept
+    {
+        return m_sigma;
+    }
+
+    //- Element access.  An element is found by binary search of the column indices of its row,
+    //  which are C positions apart.
+    //
+    constexpr const_reference
+    operator ()(size_type i, size_type j) const
+    {
+        size_type const     slot  = static_cast<size_type>(m_slots[i]);
+        size_type const     first = static_cast<size_type>(m_offsets[slot / C]) + slot % C;
+        IT const            q     = static_cast<IT>(j);
+        size_type           lo    = 0;
+        size_type           hi    = static_cast<size_type>(m_lengths[slot]);
+
+        while (lo < hi)
+        {
+            size_type const     pivot = lo + (hi - lo) / 2;
+
+            if (m_indices[first + pivot*C] < q)
+            {
+                lo = pivot + 1;
+            }
+            else
+            {
+                hi = pivot;
+            }
+        }
+
+        if (lo < static_cast<size_type>(m_lengths[slot])  &&  m_indices[first + lo*C] == q)
+        {
+            return m_values[first + lo*C];
+        }
+        return element_type{};
+    }
+
+    //- Access to the sliced arrays, for use by the sparse kernels.
+    //
+    constexpr std::span<IT const>
+    slice_offsets() const noexcept
+    {
+        return std::span<IT const>(m_offsets.data(), m_offsets.size());
+    }
+
+    constexpr std::span<IT const>
+    row_lengths() const noexcept
+    {
+        return std::span<IT const>(m_lengths.data(), m_lengths.size());
+    }
+
+    constexpr std::span<IT const>
+    row_permutation() const noexcept
+    {
+        return std::span<IT const>(m_permutation.data(), m_permutation.size());
+    }
+
+    constexpr std::span<IT const>
+    column_indices() const noexcept
+    {
+        return std::span<IT const>(m_indices.data(), m_indices.size());
+    }
+
+    constexpr std::span<T const>
+    values() const noexcept
+    {
+        return std::span<T const>(m_values.data(), m_values.size());
+    }
+
+    //- Other modifiers.
+    //
+    constexpr void
+    swap(sliced_ellpack_engine& rhs) noexcept
+    {
+        std::swap(m_rows, rhs.m_rows);
+        std::swap(m_cols, rhs.m_cols);
+        std::swap(m_sigma, rhs.m_sigma);
+        std::swap(m_nonzeros, rhs.m_nonzeros);
+        m_offsets.swap(rhs.m_offsets);
+        m_lengths.swap(rhs.m_lengths);
+        m_permutation.swap(rhs.m_permutation);
+        m_slots.swap(rhs.m_slots);
+        m_indices.swap(rhs.m_indices);
+        m_values.swap(rhs.m_values);
+    }
+
+  private:
+    size_type           m_rows;
+    size_type           m_cols;
+    size_type           m_sigma;
+    size_type           m_nonzeros;
+    index_array_type    m_offsets;
+    index_array_type    m_lengths;
+    index_array_type    m_permutation;
+    index_array_type    m_slots;
+    index_array_type    m_indices;
+    element_array_type  m_values;
+
+    static constexpr size_type
+    slice_count(size_type rows) noexcept
+    {
+        return (rows + C - 1) / C;
+    }
+
+    //- Ensure that an index or an offset can be represented by the index type.
+    //
+    static constexpr void
+    verify_index(size_type n)
+    {
+        if (n > static_cast<size_type>(std::numeric_limits<IT>::max()))
+        {
+            throw runtime_error("sparse matrix index out of range for index type");
+        }
+    }
+
+    //- Ensure that each sorting window is a whole number of slices, so that no slice spans two
+    //  windows.
+    //
+    static constexpr void
+    verify_sorting_scope(size_type sigma)
+    {
+        if (sigma == 0  ||  (sigma != 1  &&  sigma % C != 0))
+        {
+            throw runtime_error("invalid sorting scope for sliced ellpack matrix");
+        }
+    }
+
+    //- Convert the three arrays of a matrix in compressed sparse row form.
+    //
+    template<class IT2, class T2>
+    constexpr void
+    convert(std::span<IT2 const> offsets, std::span<IT2 const> indices, std::span<T2 const> values)
+    {
+        size_type const     nslices = slice_count(m_rows);
+
+        auto    row_length = [&](size_type i) -> size_type
+        {
+            return static_cast<size_type>(offsets[i + 1]) - static_cast<size_type>(offsets[i]);
+        };
+
+        //- Sort the rows by decreasing length within each window; a stable sort keeps rows of
+        //  equal length in their original order.
+        //
+        m_permutation.resize(m_rows);
+        std::iota(m_permutation.begin(), m_permutation.end(), IT{0});
+
+        for (size_type w = 0;  m_sigma > 1  &&  w < m_rows;  w += m_sigma)
+        {
+            auto const  first = m_permutation.begin() + static_cast<ptrdiff_t>(w);
+            auto const  last  = m_permutation.begin() + static_cast<ptrdiff_t>(std::min(w + m_sigma, m_rows));
+
+            std::stable_sort(first, last, [&](IT a, IT b)
+            {
+                return row_length(static_cast<size_type>(a)) > row_length(static_cast<size_type>(b));
+            });
+        }
+
+        //- Each slice is as wide as its longest row.
+        //
+        m_lengths.assign(nslices * C, IT{0});
+        m_offsets.assign(nslices + 1, IT{0});
+
+        for (size_type s = 0;  s < nslices;  ++s)
+        {
+            size_type   width = 0;
+
+            for (size_type k = s*C;  k < std::min((s + 1)*C, m_rows);  ++k)
+            {
+                size_type const     len = row_length(static_cast<size_type>(m_permutation[k]));
+
+                m_lengths[k] = static_cast<IT>(len);
+                width        = std::max(width, len);
+            }
+            verify_index(static_cast<size_type>(m_offsets[s]) + width*C);
+            m_offsets[s + 1] = static_cast<IT>(static_cast<size_type>(m_offsets[s]) + width*C);
+        }
+
+        //- Scatter the elements of each row into the column of its slot.
+        //
+        m_indices.assign(static_cast<size_type>(m_offsets[nslices]), IT{0});
+        m_values.assign(static_cast<size_type>(m_offsets[nslices]), element_type{});
+
+        for (size_type k = 0;  k < m_rows;  ++k)
+        {
+            size_type const     i     = static_cast<size_type>(m_permutation[k]);
+            size_type const     first = static_cast<size_type>(m_offsets[k / C]) + k % C;
+            size_type const     k0    = static_cast<size_type>(offsets[i]);
+
+            for (size_type p = 0;  p < row_length(i);  ++p)
+            {
+                m_indices[first + p*C] = static_cast<IT>(indices[k0 + p]);
+                m_values[first + p*C]  = static_cast<element_type>(values[k0 + p]);
+            }
+        }
+
+        make_slots();
+    }
+
+    //- Invert the row permutation, for element access.
+    //
+    constexpr void
+    make_slots()
+    {
+        m_slots.resize(m_rows);
+
+        for (size_type k = 0;  k < m_rows;  ++k)
+        {
+            m_slots[static_cast<size_type>(m_permutation[k])] = static_cast<IT>(k);
+        }
+    }
+};
+
+
+namespace detail {
+//- A default-constructed sliced ELLPACK engine has extents of zero, which are not constexpr
+//  extents.
+//
+template<class T, class IT, class AT, size_t C>
+struct has_runtime_extents<sliced_ellpack_engine<T, IT, AT, C>> : public true_type
+{};
+
+}       //- detail namespace
+}       //- STD_LA namespace
+#endif  //- LINEAR_ALGEBRA_SLICED_ELLPACK_ENGINE_HPP_DEFINED
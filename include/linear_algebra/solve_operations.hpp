@@ -0,0 +1,353 @@
+//==================================================================================================
+//  File:       solve_operations.hpp
+//
+//  Summary:    This header defines public functions that solve systems of linear equations and
+//              invert square matrices by Gaussian elimination.
+//==================================================================================================
+//
+#ifndef LINEAR_ALGEBRA_SOLVE_OPERATIONS_HPP_DEFINED
+#define LINEAR_ALGEBRA_SOLVE_OPERATIONS_HPP_DEFINED
+
+namespace STD_LA {
+namespace detail {
+//--------------------------------------------------------------------------------------------------
+//  Class Template:     pivot_traits<T>
+//
+//  This private traits type describes how the elimination loops below choose pivots for
+//  elements of type T.  A candidate pivot replaces the best one so far if its magnitude is
+//  greater; for complex elements, the magnitude is |re| + |im|, as in the reference BLAS, which
+//  avoids a square root and may be computed during constant evaluation.
+//
+//  The search over a column yields the index of the pivot row, and the pivot row is then
+//  exchanged with the current row in a single pass.  For ordinary elements, the index is a
+//  single row number.  For batch_element<T, N>, there is one row number per lane, so that each
+//  matrix of the batch is pivoted independently, and the rows are exchanged lane by lane, only
+//  in the lanes whose pivot row differs from the current row.
+//--------------------------------------------------------------------------------------------------
+//
+template<class T>
+struct pivot_traits
+{
+    using index_type = size_t;
+
+    static constexpr auto
+    magnitude(T const& x) noexcept
+    {
+        if constexpr (is_complex_v<T>)
+        {
+            auto const  re = x.real();
+            auto const  im = x.imag();
+
+            return ((re < 0) ? -re : re) + ((im < 0) ? -im : im);
+        }
+        else
+        {
+            return (x < T{}) ? -x : x;
+        }
+    }
+
+    static constexpr index_type
+    initial_index(size_t k) noexcept
+    {
+        return k;
+    }
+
+    //- Make row r the pivot row if its candidate x is of greater magnitude than the best so far.
+    //
+    static constexpr void
+    select(size_t r, T const& x, T& best, index_type& p) noexcept
+    {
+        if (magnitude(x) > magnitude(best))
+        {
+            best = x;
+            p    = r;
+        }
+    }
+
+    static constexpr bool
+    any_exchange(index_type p, size_t k) noexcept
+    {
+        return p != k;
+    }
+
+    //- Exchange the elements of row k and of the pivot row, where at(r) is the element of row r.
+    //
+    template<class AT>
+    static constexpr void
+    exchange(index_type p, size_t k, AT&& at)
+    {
+        if (p != k) std::swap(at(p), at(k));
+    }
+
+    static constexpr bool
+    any_zero(T const& x) noexcept
+    {
+        return x == T{};
+    }
+};
+
+template<class T, size_t N>
+struct pivot_traits<batch_element<T, N>>
+{
+    using element_type = batch_element<T, N>;
+    using index_type   = array<size_t, N>;
+
+    static constexpr index_type
+    initial_index(size_t k) noexcept
+    {
+        index_type  p{};
+
+        for (size_t i = 0;  i < N;  ++i)
+        {
+            p[i] = k;
+        }
+        return p;
+    }
+
+    static constexpr void
+    select(size_t r, element_type const& x, element_type& best, index_type& p) noexcept
+    {
+        for (size_t i = 0;  i < N;  ++i)
+        {
+            if (pivot_traits<T>::magnitude(x[i]) > pivot_traits<T>::magnitude(best[i]))
+            {
+                best[i] = x[i];
+                p[i]    = r;
+            }
+        }
+    }
+
+    static constexpr bool
+    any_exchange(index_type const& p, size_t k) noexcept
+    {
+        bool    r = false;
+
+        for (size_t i = 0;  i < N;  ++i)
+        {
+            r = r || (p[i] != k);
+        }
+        return r;
+    }
+
+    template<class AT>
+    static constexpr void
+    exchange(index_type const& p, size_t k, AT&& at)
+    {
+        element_type&   xk = at(k);
+
+        for (size_t i = 0;  i < N;  ++i)
+        {
+            if (p[i] != k) std::swap(at(p[i])[i], xk[i]);
+        }
+    }
+
+    static constexpr bool
+    any_zero(element_type const& x) noexcept
+    {
+        bool    r = false;
+
+        for (size_t i = 0;  i < N;  ++i)
+        {
+            r = r || (x[i] == T{});
+        }
+        return r;
+    }
+};
+
+
+//--------------------------------------------------------------------------------------------------
+//  Class:      solve_operation_support
+//
+//  This private type implements Gaussian elimination with partial pivoting, which is shared by
+//  the public functions defined below.
+//--------------------------------------------------------------------------------------------------
+//
+struct solve_operation_support
+{
+    //- Overwrite X, which initially holds B, with the solution of A*X = B, destroying A in the
+    //  process.  A must be square, and have as many rows as X.  A is reduced to upper-triangular
+    //  form, with the same row operations applied to X, and then X is found by back substitution.
+    //
+    template<class MTA, class MTX>
+    static constexpr void
+    solve_in_place(MTA& a, MTX& x)
+    {
+        using element_type = typename MTA::element_type;
+        using size_type_a  = typename MTA::size_type;
+        using size_type_x  = typename MTX::size_type;
+        using pivot        = pivot_traits<element_type>;
+
+        size_type_a const   n    = a.rows();
+        size_type_x const   nrhs = x.columns();
+
+        for (size_type_a k = 0;  k < n;  ++k)
+        {
+            size_type_x const   kx = static_cast<size_type_x>(k);
+
+            //- Find the candidate of greatest magnitude, and bring it to the pivot row.
+            //
+            auto            p    = pivot::initial_index(static_cast<size_t>(k));
+            element_type    best = a(k, k);
+
+            for (size_type_a r = k + 1;  r < n;  ++r)
+            {
+                pivot::select(static_cast<size_t>(r), a(r, k), best, p);
+            }
+
+            if (pivot::any_exchange(p, static_cast<size_t>(k)))
+            {
+                for (size_type_a c = k;  c < n;  ++c)
+                {
+                    pivot::exchange(p, static_cast<size_t>(k), [&](size_t r) -> decltype(auto)
+                    {
+                        return a(static_cast<size_type_a>(r), c);
+                    });
+                }
+                for (size_type_x c = 0;  c < nrhs;  ++c)
+                {
+                    pivot::exchange(p, static_cast<size_t>(k), [&](size_t r) -> decltype(auto)
+                    {
+                        return x(static_cast<size_type_x>(r), c);
+                    });
+                }
+            }
+
+            if (pivot::any_zero(a(k, k)))
+            {
+                throw runtime_error("singular matrix for solve");
+            }
+
+            //- Eliminate the elements below the pivot.
+            //
+            element_type const  inv = element_type(1) / a(k, k);
+
+            for (size_type_a r = k + 1;  r < n;  ++r)
+            {
+                size_type_x const   rx = static_cast<size_type_x>(r);
+                element_type const  f  = a(r, k) * inv;
+
+                for (size_type_a c = k + 1;  c < n;  ++c)
+                {
+                    a(r, c) = a(r, c) - f * a(k, c);
+                }
+                for (size_type_x c = 0;  c < nrhs;  ++c)
+                {
+                    x(rx, c) = x(rx, c) - f * x(kx, c);
+                }
+            }
+        }
+
+        //- Back substitution, one row of X at a time, from the last.
+        //
+        for (size_type_a k = n;  k-- > 0;)
+        {
+            size_type_x const   kx  = static_cast<size_type_x>(k);
+            element_type const  inv = element_type(1) / a(k, k);
+
+            for (size_type_x c = 0;  c < nrhs;  ++c)
+            {
+                element_type    s = x(kx, c);
+
+                for (size_type_a j = k + 1;  j < n;  ++j)
+                {
+                    s = s - a(k, j) * x(static_cast<size_type_x>(j), c);
+                }
+                x(kx, c) = s * inv;
+            }
+        }
+    }
+
+    template<class ET, class COT>
+    static constexpr void
+    resize(matrix<ET, COT>& m, size_t rows, size_t cols)
+    {
+        using size_type = typename matrix<ET, COT>::size_type;
+
+        if constexpr (reshapable_matrix_engine<ET>)
+        {
+            m.resize(static_cast<size_type>(rows), static_cast<size_type>(cols));
+        }
+    }
+};
+
+}       //- detail namespace
+
+
+//--------------------------------------------------------------------------------------------------
+//  Function:   solve(A, B)
+//
+//  Returns the matrix X that solves A*X = B, where A is square, computed by Gaussian elimination
+//  with partial pivoting.  B may have any number of columns, each of which is a right-hand side.
+//  The result has the extents of B, and is of fixed size if B's extents are known at compile
+//  time.  If A is singular, an exception is thrown.
+//
+//  For matrices of batch_element<T, N>, each of the N systems of the batch is solved with its
+//  own pivots, and an exception is thrown if any of them is singular.
+//--------------------------------------------------------------------------------------------------
+//
+template<class ET1, class COT1, class ET2, class COT2>
+requires
+    same_as<typename ET1::element_type, typename ET2::element_type>
+constexpr auto
+solve(matrix<ET1, COT1> const& a, matrix<ET2, COT2> const& b)
+{
+    using support = detail::solve_operation_support;
+
+    if (detail::matrix_engine_support::sizes_differ(a.rows(), a.columns()))
+    {
+        throw runtime_error("non-square matrix for solve");
+    }
+    if (detail::matrix_engine_support::sizes_differ(a.rows(), b.rows()))
+    {
+        throw runtime_error("mis-matched operand sizes for solve");
+    }
+
+    matrix<detail::temporary_engine_t<ET1>, COT1>  w(a);
+    matrix<detail::temporary_engine_t<ET2>, COT2>  x(b);
+
+    support::solve_in_place(w, x);
+    return x;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+//  Function:   inverse(A)
+//
+//  Returns the inverse of the square matrix A, computed by solving A*X = I as above.  If A is
+//  singular, an exception is thrown.
+//--------------------------------------------------------------------------------------------------
+//
+template<class ET, class COT>
+constexpr auto
+inverse(matrix<ET, COT> const& a)
+{
+    using support      = detail::solve_operation_support;
+    using element_type = typename ET::element_type;
+    using result_type  = matrix<detail::temporary_engine_t<ET>, COT>;
+    using size_type    = typename result_type::size_type;
+
+    if (detail::matrix_engine_support::sizes_differ(a.rows(), a.columns()))
+    {
+        throw runtime_error("non-square matrix for inverse");
+    }
+
+    size_t const    n = static_cast<size_t>(a.rows());
+    result_type     w(a);
+    result_type     x;
+
+    support::resize(x, n, n);
+
+    for (size_type i = 0;  i < static_cast<size_type>(n);  ++i)
+    {
+        for (size_type j = 0;  j < static_cast<size_type>(n);  ++j)
+        {
+            x(i, j) = (i == j) ? element_type(1) : element_type(0);
+        }
+    }
+
+    support::solve_in_place(w, x);
+    return x;
+}
+
+}       //- STD_LA namespace
+#endif  //- LINEAR_ALGEBRA_SOLVE_OPERATIONS_HPP_DEFINED
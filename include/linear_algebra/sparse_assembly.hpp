@@ -0,0 +1,832 @@
+//==================================================================================================
+//  File:       sparse_assembly.hpp
+//
+//  Summary:    This header defines a public builder that collects the elements of a sparse matrix
+//              as (row, column, value) triplets inserted concurrently by many threads, and then
+//              compresses them in parallel, summing duplicates, into a sparse_matrix_engine.
+//==================================================================================================
+//
+#ifndef LINEAR_ALGEBRA_SPARSE_ASSEMBLY_HPP_DEFINED
+#define LINEAR_ALGEBRA_SPARSE_ASSEMBLY_HPP_DEFINED
+
+namespace STD_LA {
+namespace detail {
+//--------------------------------------------------------------------------------------------------
+//  Class:      sparse_assembly_support
+//
+//  This private type implements the parallel steps of compressing a list of (key, value) pairs
+//  into the three arrays of a compressed sparse engine, where the key of element (p, q) in the
+//  major (compressed) and minor (indexed) dimensions is p*minor + q.  The compression has two
+//  phases: a symbolic phase, which determines the sparsity pattern and where each pair's value
+//  is summed, and a numeric phase, which sums the values.
+//
+//  In the symbolic phase, the keys and their positions in the list are first ordered by a
+//  stable least-significant-digit radix sort of the keys, eight bits per pass, using only as
+//  many passes as there are digits in the largest key.  Each pass divides the pairs into
+//  contiguous chunks, one per thread; each chunk counts its digits, the counts of all chunks are
+//  scanned in (digit, chunk) order, and each chunk then scatters its pairs to their final
+//  positions independently.  Passes in which every key has the same digit are skipped.  Equal
+//  keys are then adjacent, in the order in which they were listed, and form runs, one for each
+//  element of the pattern.  The chunks of the merge are adjusted so that no run spans two of
+//  them; each chunk counts its runs, the counts are scanned, and each chunk then writes the
+//  indices of its elements, the offsets of the major indices at which they begin, and where
+//  its runs begin.
+//
+//  In the numeric phase, each element is the sum of the values of its run, in list order, so
+//  the result does not depend on the number of threads, and each thread writes only its own
+//  elements.
+//--------------------------------------------------------------------------------------------------
+//
+struct sparse_assembly_support
+{
+    using key_type = uint64_t;
+
+    static constexpr size_t     radix_bits = 8;
+    static constexpr size_t     radix_size = size_t{1} << radix_bits;
+    static constexpr key_type   radix_mask = radix_size - 1;
+
+    //- The number of chunks into which n items are divided, which is the number of threads that
+    //  batch_executor would use for them.
+    //
+    static size_t
+    chunk_count(size_t n, size_t max_threads) noexcept
+    {
+        return std::clamp<size_t>(n / batch_executor::min_thread_work, 1, max_threads);
+    }
+
+    static size_t
+    chunk_begin(size_t c, size_t n, size_t chunks) noexcept
+    {
+        return c * n / chunks;
+    }
+
+    //- Sort the keys and their list positions by key, where no key exceeds max_key.
+    //
+    static void
+    sort(std::vector<key_type>& keys, std::vector<size_t>& perm, key_type max_key, size_t max_threads)
+    {
+        size_t const    n      = keys.size();
+        size_t const    chunks = chunk_count(n, max_threads);
+        size_t const    work   = n / chunks;
+
+        std::vector<key_type>   keys2(n);
+        std::vector<size_t>     perm2(n);
+        std::vector<size_t>     counts(chunks * radix_size);
+
+        perm.resize(n);
+
+        for (size_t k = 0;  k < n;  ++k)
+        {
+            perm[k] = k;
+        }
+
+        for (size_t shift = 0;  shift < 64  &&  (max_key >> shift) != 0;  shift += radix_bits)
+        {
+            std::fill(counts.begin(), counts.end(), size_t{0});
+
+            batch_executor::for_each(chunks, work, [&](size_t c)
+            {
+                size_t* const   h = &counts[c * radix_size];
+
+                for (size_t k = chunk_begin(c, n, chunks);  k < chunk_begin(c + 1, n, chunks);  ++k)
+                {
+                    ++h[(keys[k] >> shift) & radix_mask];
+                }
+            },
+            max_threads);
+
+            //- Convert the counts into the position at which each chunk writes each digit.
+            //
+            size_t  pos     = 0;
+            bool    uniform = false;
+
+            for (size_t d = 0;  d < radix_size  &&  not uniform;  ++d)
+            {
+                size_t  total = 0;
+
+                for (size_t c = 0;  c < chunks;  ++c)
+                {
+                    total += counts[c * radix_size + d];
+                }
+                uniform = (total == n);
+            }
+            if (uniform)
+            {
+                continue;
+            }
+            for (size_t d = 0;  d < radix_size;  ++d)
+            {
+                for (size_t c = 0;  c < chunks;  ++c)
+                {
+                    size_t const    cnt = counts[c * radix_size + d];
+
+                    counts[c * radix_size + d] = pos;
+                    pos += cnt;
+                }
+            }
+
+            batch_executor::for_each(chunks, work, [&](size_t c)
+            {
+                size_t* const   h = &counts[c * radix_size];
+
+                for (size_t k = chunk_begin(c, n, chunks);  k < chunk_begin(c + 1, n, chunks);  ++k)
+                {
+                    size_t const    dst = h[(keys[k] >> shift) & radix_mask]++;
+
+                    keys2[dst] = keys[k];
+                    perm2[dst] = perm[k];
+                }
+            },
+            max_threads);
+
+            keys.swap(keys2);
+            perm.swap(perm2);
+        }
+    }
+
+    //- Merge the sorted keys into the offsets and indices of a compressed sparse engine having
+    //  the given major and minor extents, and record where the run of each element begins.
+    //
+    template<class IT, class IAT>
+    static void
+    merge(std::vector<key_type> const& keys, size_t nmajor, size_t nminor,
+          std::vector<IT, IAT>& offsets, std::vector<IT, IAT>& indices, std::vector<size_t>& runs,
+          size_t max_threads)
+    {
+        size_t const    n      = keys.size();
+        size_t const    chunks = chunk_count(n, max_threads);
+        size_t const    work   = n / chunks;
+
+        //- Move each chunk boundary forward to the start of a run of equal keys.
+        //
+        std::vector<size_t>     bounds(chunks + 1);
+        std::vector<size_t>     starts(chunks + 1, 0);
+
+        for (size_t c = 0;  c <= chunks;  ++c)
+        {
+            size_t  b = chunk_begin(c, n, chunks);
+
+            while (b != 0  &&  b < n  &&  keys[b] == keys[b - 1])
+            {
+                ++b;
+            }
+            bounds[c] = b;
+        }
+
+        batch_executor::for_each(chunks, work, [&](size_t c)
+        {
+            size_t  unique = 0;
+
+            for (size_t k = bounds[c];  k < bounds[c + 1];  ++k)
+            {
+                unique += (k == bounds[c]  ||  keys[k] != keys[k - 1]) ? 1 : 0;
+            }
+            starts[c + 1] = unique;
+        },
+        max_threads);
+
+        for (size_t c = 0;  c < chunks;  ++c)
+        {
+            starts[c + 1] += starts[c];
+        }
+
+        size_t const    nnz = starts[chunks];
+
+        if (nnz > static_cast<size_t>(std::numeric_limits<IT>::max()))
+        {
+            throw runtime_error("sparse matrix index out of range for index type");
+        }
+
+        offsets.assign(nmajor + 1, IT{0});
+        indices.resize(nnz);
+        runs.resize(nnz + 1);
+        runs[nnz] = n;
+
+        //- Each chunk writes the offsets of the major indices after that of the last element of
+        //  the previous chunk, up to and including that of its own last element.
+        //
+        batch_executor::for_each(chunks, work, [&](size_t c)
+        {
+            size_t  pos  = starts[c];
+            size_t  next = (bounds[c] == 0) ? 0 : static_cast<size_t>(keys[bounds[c] - 1] / nminor) + 1;
+
+            for (size_t k = bounds[c];  k < bounds[c + 1];  ++k)
+            {
+                if (k == bounds[c]  ||  keys[k] != keys[k - 1])
+                {
+                    size_t const    p = static_cast<size_t>(keys[k] / nminor);
+
+                    for (;  next <= p;  ++next)
+                    {
+                        offsets[next] = static_cast<IT>(pos);
+                    }
+                    indices[pos] = static_cast<IT>(keys[k] % nminor);
+                    runs[pos]    = k;
+                    ++pos;
+                }
+            }
+        },
+        max_threads);
+
+        size_t  next = (n == 0) ? 0 : static_cast<size_t>(keys[n - 1] / nminor) + 1;
+
+        for (;  next <= nmajor;  ++next)
+        {
+            offsets[next] = static_cast<IT>(nnz);
+        }
+    }
+
+    //- Sum the listed values of each run into the corresponding element of values.
+    //
+    template<class T>
+    static void
+    sum_runs(T const* vals, std::vector<size_t> const& perm, std::vector<size_t> const& runs,
+             std::span<T> values, size_t max_threads)
+    {
+        size_t const    nnz    = values.size();
+        size_t const    chunks = chunk_count(perm.size(), max_threads);
+
+        batch_executor::for_each(chunks, perm.size() / chunks, [&](size_t c)
+        {
+            for (size_t p = chunk_begin(c, nnz, chunks);  p < chunk_begin(c + 1, nnz, chunks);  ++p)
+            {
+                T   sum = vals[perm[runs[p]]];
+
+                for (size_t r = runs[p] + 1;  r < runs[p + 1];  ++r)
+                {
+                    sum = sum + vals[perm[r]];
+                }
+                values[p] = sum;
+            }
+        },
+        max_threads);
+    }
+};
+
+//--------------------------------------------------------------------------------------------------
+//  Concept:    valid_sparse_builder_arguments<T, IT, AT, SAT>
+//
+//  This private concept is used to validate the template arguments of sparse_matrix_builder.
+//--------------------------------------------------------------------------------------------------
+//
+template<class T, class IT, class AT, class SAT>
+concept valid_sparse_builder_arguments =
+    valid_sparse_engine_arguments<T, IT, AT, matrix_layout::row_major>
+    and
+    (same_as<SAT, sparse_assembly::coordinate> or same_as<SAT, sparse_assembly::dictionary>);
+
+}       //- detail namespace
+
+
+//--------------------------------------------------------------------------------------------------
+//  Class:      sparse_scatter_map
+//
+//  This public type holds the result of the symbolic phase of compressing the elements held by
+//  a sparse_matrix_builder: where the elements of each buffer begin in the gathered list of
+//  elements, and the position in the compressed values at which each of them is summed.  It is
+//  produced by compress(map), and used by compress_values(map, engine) to recompute only the
+//  values of a matrix having the same sparsity pattern, without sorting the elements or
+//  allocating the compressed arrays.
+//--------------------------------------------------------------------------------------------------
+//
+class sparse_scatter_map
+{
+  public:
+    using size_type = size_t;
+
+  public:
+    sparse_scatter_map() = default;
+
+    size_type
+    columns() const noexcept
+    {
+        return m_cols;
+    }
+
+    size_type
+    rows() const noexcept
+    {
+        return m_rows;
+    }
+
+    //- The number of elements of the compressed matrix.
+    //
+    size_type
+    nonzeros() const noexcept
+    {
+        return (m_runs.empty()) ? 0 : m_runs.size() - 1;
+    }
+
+    //- The number of elements inserted, including duplicates.
+    //
+    size_type
+    size() const noexcept
+    {
+        return m_perm.size();
+    }
+
+  private:
+    template<class T, class IT, class AT, class SAT>
+    requires
+        detail::valid_sparse_builder_arguments<T, IT, AT, SAT>
+    friend class sparse_matrix_builder;
+
+    size_type               m_rows = 0;
+    size_type               m_cols = 0;
+    bool                    m_row_major = true;
+    std::vector<size_type>  m_firsts;   //- List position of the first element of each buffer
+    std::vector<size_type>  m_perm;     //- List position of each element, in sorted order
+    std::vector<size_type>  m_runs;     //- Where the run of each compressed element begins
+};
+
+
+//--------------------------------------------------------------------------------------------------
+//  Class Template:     sparse_matrix_builder<T, IT, AT, SAT>
+//
+//  This class template assembles a sparse matrix of the given extents from elements inserted
+//  in any order, possibly more than once, and then compresses them into a sparse_matrix_engine
+//  in either compressed sparse row or compressed sparse column form.  Elements inserted more
+//  than once at the same position are summed, as when assembling a finite-element matrix.
+//
+//  The builder holds a number of buffers, chosen at construction, into which elements are
+//  inserted.  Each buffer is used by at most one thread at a time, and buffers are otherwise
+//  independent, so that many threads may insert concurrently without locking by each using
+//  its own buffer; e.g., thread t of a pool of N threads inserts into buffer(t).
+//
+//  The assembly type SAT determines how each buffer holds its elements:
+//
+//      - sparse_assembly::coordinate appends each element to a list of (row, column, value)
+//        triplets, which is the fastest way to insert, but stores every duplicate;
+//      - sparse_assembly::dictionary sums each element into a hash map keyed by its position,
+//        which stores each position once per buffer, and so suits random incremental updates
+//        of a modest number of positions.
+//
+//  The member function compress() gathers the buffers, sorts the elements by position and sums
+//  duplicates, in parallel, as described for detail::sparse_assembly_support.  For coordinate
+//  assembly, duplicates are summed in the order of the buffers and then of insertion, so the
+//  result does not depend on the number of threads.  Positions whose elements sum to zero are
+//  stored, so that the sparsity pattern depends only on the positions inserted.
+//
+//  When a matrix having the same sparsity pattern is assembled repeatedly, as in a time-stepping
+//  loop, the symbolic phase need only be computed once.  For coordinate assembly, compress(map)
+//  also records a sparse_scatter_map, and thereafter compress_values(map, engine) sums the
+//  elements of each new assembly directly into the values of the engine.  Each new assembly
+//  must insert the same positions, in the same order, into the same buffers; only the number
+//  of elements in each buffer is checked.  The buffers then keep their storage, so that the
+//  next assembly does not allocate either.
+//--------------------------------------------------------------------------------------------------
+//
+template<class T, class IT = size_t, class AT = std::allocator<T>,
+         class SAT = sparse_assembly::coordinate>
+requires
+    detail::valid_sparse_builder_arguments<T, IT, AT, SAT>
+class sparse_matrix_builder
+{
+    using this_type    = sparse_matrix_builder;
+    using support_type = detail::sparse_assembly_support;
+    using key_type     = typename support_type::key_type;
+
+    static constexpr bool   has_dictionary = is_same_v<SAT, sparse_assembly::dictionary>;
+
+  public:
+    using element_type   = T;
+    using index_type     = IT;
+    using allocator_type = AT;
+    using assembly_type  = SAT;
+    using size_type      = size_t;
+
+    template<class LT>
+    using engine_type = sparse_matrix_engine<T, IT, AT, LT>;
+
+    //- Each buffer is aligned to a cache line, so that threads updating adjacent buffers do not
+    //  contend for the same line.
+    //
+    class alignas(64) buffer_type
+    {
+        using index_allocator_type = typename std::allocator_traits<AT>::template rebind_alloc<IT>;
+        using entry_allocator_type = typename std::allocator_traits<AT>::template
+                                         rebind_alloc<std::pair<key_type const, T>>;
+
+        using index_array_type   = std::vector<IT, index_allocator_type>;
+        using element_array_type = std::vector<T, AT>;
+        using dictionary_type    = std::unordered_map<key_type, T, std::hash<key_type>,
+                                                      std::equal_to<key_type>, entry_allocator_type>;
+
+      public:
+        //- Add v to element (i, j).
+        //
+        void
+        insert(size_type i, size_type j, element_type const& v)
+        {
+            if (i >= m_rows  ||  j >= m_cols)
+            {
+                throw runtime_error("sparse matrix assembly index out of range");
+            }
+
+            if constexpr (has_dictionary)
+            {
+                auto const  [pos, inserted] = m_entries.try_emplace(static_cast<key_type>(i) * m_cols + j, v);
+
+                if (not inserted)
+                {
+                    pos->second = pos->second + v;
+                }
+            }
+            else
+            {
+                m_row_indices.push_back(static_cast<IT>(i));
+                m_col_indices.push_back(static_cast<IT>(j));
+                m_values.push_back(v);
+            }
+        }
+
+        //- The number of elements held, including duplicates.
+        //
+        size_type
+        size() const noexcept
+        {
+            if constexpr (has_dictionary)
+            {
+                return m_entries.size();
+            }
+            else
+            {
+                return m_values.size();
+            }
+        }
+
+        void
+        reserve(size_type n)
+        {
+            if constexpr (has_dictionary)
+            {
+                m_entries.reserve(n);
+            }
+            else
+            {
+                m_row_indices.reserve(n);
+                m_col_indices.reserve(n);
+                m_values.reserve(n);
+            }
+        }
+
+        void
+        clear() noexcept
+        {
+            //- Release the storage as well, since it may be large.
+            //
+            dictionary_type().swap(m_entries);
+            index_array_type().swap(m_row_indices);
+            index_array_type().swap(m_col_indices);
+            element_array_type().swap(m_values);
+        }
+
+      private:
+        friend class sparse_matrix_builder;
+
+        size_type           m_rows;
+        size_type           m_cols;
+        dictionary_type     m_entries;
+        index_array_type    m_row_indices;
+        index_array_type    m_col_indices;
+        element_array_type  m_values;
+
+        buffer_type(size_type rows, size_type cols)
+        :   m_rows(rows), m_cols(cols), m_entries(), m_row_indices(), m_col_indices(), m_values()
+        {}
+
+        //- Write the keys of the held elements, in the given layout, to the array beginning at
+        //  pkeys.
+        //
+        template<class LT>
+        void
+        gather_keys(key_type* pkeys) const
+        {
+            constexpr bool  row_major = is_same_v<LT, matrix_layout::row_major>;
+
+            if constexpr (has_dictionary)
+            {
+                for (auto const& entry : m_entries)
+                {
+                    key_type const  key = entry.first;
+
+                    *pkeys++ = (row_major) ? key : (key % m_cols) * m_rows + key / m_cols;
+                }
+            }
+            else
+            {
+                for (size_type k = 0;  k < m_values.size();  ++k)
+                {
+                    key_type const  i = static_cast<key_type>(m_row_indices[k]);
+                    key_type const  j = static_cast<key_type>(m_col_indices[k]);
+
+                    pkeys[k] = (row_major) ? i * m_cols + j : j * m_rows + i;
+                }
+            }
+        }
+
+        //- Write the values of the held elements to the array beginning at pvals, in the same
+        //  order as their keys.
+        //
+        void
+        gather_values(T* pvals) const
+        {
+            if constexpr (has_dictionary)
+            {
+                for (auto const& entry : m_entries)
+                {
+                    *pvals++ = entry.second;
+                }
+            }
+            else
+            {
+                std::copy(m_values.begin(), m_values.end(), pvals);
+            }
+        }
+
+        //- Empty the buffer, keeping its storage for the next assembly of the same pattern.
+        //
+        void
+        reset() noexcept
+        {
+            m_entries.clear();
+            m_row_indices.clear();
+            m_col_indices.clear();
+            m_values.clear();
+        }
+    };
+
+  public:
+    ~sparse_matrix_builder() = default;
+
+    //- Construct / assign.
+    //
+    sparse_matrix_builder(sparse_matrix_builder&&) noexcept = default;
+    sparse_matrix_builder(sparse_matrix_builder const&) = default;
+    sparse_matrix_builder&  operator =(sparse_matrix_builder&&) noexcept = default;
+    sparse_matrix_builder&  operator =(sparse_matrix_builder const&) = default;
+
+    //- Construction of a builder for a matrix of the given extents, having the given number of
+    //  buffers, where zero means the number of hardware threads.
+    //
+    sparse_matrix_builder(size_type rows, size_type cols, size_type buffers = 0)
+    :   m_rows(rows), m_cols(cols), m_buffers(), m_gathered()
+    {
+        if (cols != 0  &&  rows > std::numeric_limits<key_type>::max() / cols)
+        {
+            throw runtime_error("sparse matrix extents too large for assembly");
+        }
+        if (std::max(rows, cols) > static_cast<size_type>(std::numeric_limits<IT>::max()))
+        {
+            throw runtime_error("sparse matrix index out of range for index type");
+        }
+        if (buffers == 0)
+        {
+            buffers = std::max(std::thread::hardware_concurrency(), 1u);
+        }
+
+        m_buffers.reserve(buffers);
+
+        for (size_type b = 0;  b < buffers;  ++b)
+        {
+            m_buffers.push_back(buffer_type(rows, cols));
+        }
+    }
+
+    //- Size reporting.
+    //
+    size_type
+    columns() const noexcept
+    {
+        return m_cols;
+    }
+
+    size_type
+    rows() const noexcept
+    {
+        return m_rows;
+    }
+
+    size_type
+    buffers() const noexcept
+    {
+        return m_buffers.size();
+    }
+
+    //- The number of elements held by all buffers, including duplicates.
+    //
+    size_type
+    size() const noexcept
+    {
+        size_type   n = 0;
+
+        for (auto const& buf : m_buffers)
+        {
+            n += buf.size();
+        }
+        return n;
+    }
+
+    //- Buffer access.
+    //
+    buffer_type&
+    buffer(size_type b)
+    {
+        return m_buffers[b];
+    }
+
+    buffer_type const&
+    buffer(size_type b) const
+    {
+        return m_buffers[b];
+    }
+
+    //- Add v to element (i, j), using the first buffer.  This is for use by a single thread.
+    //
+    void
+    insert(size_type i, size_type j, element_type const& v)
+    {
+        m_buffers[0].insert(i, j, v);
+    }
+
+    void
+    clear() noexcept
+    {
+        for (auto& buf : m_buffers)
+        {
+            buf.clear();
+        }
+    }
+
+    //- Compress the elements held into an engine having the layout LT, using up to max_threads
+    //  threads, where zero means the number of hardware threads.  The buffers are emptied as
+    //  their elements are gathered, leaving the builder ready for reuse.
+    //
+    template<class LT = matrix_layout::row_major>
+    engine_type<LT>
+    compress(size_t max_threads = 0)
+    requires
+        detail::valid_layout_for_storage_engine<LT>
+    {
+        sparse_scatter_map  map;
+
+        return compress_pattern<LT>(map, false, max_threads);
+    }
+
+    //- Compress as above, recording the symbolic phase in map.  The buffers keep their storage
+    //  for the next assembly of the same pattern.
+    //
+    template<class LT = matrix_layout::row_major>
+    engine_type<LT>
+    compress(sparse_scatter_map& map, size_t max_threads = 0)
+    requires
+        detail::valid_layout_for_storage_engine<LT>
+        and
+        (not this_type::has_dictionary)
+    {
+        return compress_pattern<LT>(map, true, max_threads);
+    }
+
+    //- Compute the values of eng, whose pattern was computed by compress(map), from the elements
+    //  held, which must have been inserted into the same positions in the same order.  The
+    //  buffers are emptied, but keep their storage.
+    //
+    template<class LT>
+    void
+    compress_values(sparse_scatter_map const& map, engine_type<LT>& eng, size_t max_threads = 0)
+    requires
+        (not this_type::has_dictionary)
+    {
+        constexpr bool  row_major = is_same_v<LT, matrix_layout::row_major>;
+
+        size_type const     count = m_buffers.size();
+        bool                valid = (map.m_rows == m_rows)  &&  (map.m_cols == m_cols)
+                                 && (map.m_row_major == row_major)  &&  (map.m_firsts.size() == count + 1)
+                                 && (eng.rows() == m_rows)  &&  (eng.columns() == m_cols)
+                                 && (eng.nonzeros() == map.nonzeros());
+
+        for (size_type b = 0;  valid  &&  b < count;  ++b)
+        {
+            valid = (m_buffers[b].size() == map.m_firsts[b + 1] - map.m_firsts[b]);
+        }
+        if (not valid)
+        {
+            throw runtime_error("sparse matrix assembly does not match its pattern");
+        }
+
+        if (max_threads == 0)
+        {
+            max_threads = std::max(std::thread::hardware_concurrency(), 1u);
+        }
+
+        //- The elements of a single buffer are already in list order, and are summed in place;
+        //  otherwise they are gathered into storage that is kept for the next assembly.
+        //
+        std::vector<size_type> const&   firsts = map.m_firsts;
+
+        if (count == 1)
+        {
+            support_type::sum_runs(m_buffers[0].m_values.data(), map.m_perm, map.m_runs, eng.values(),
+                                   max_threads);
+            m_buffers[0].reset();
+            return;
+        }
+
+        m_gathered.resize(firsts[count]);
+
+        detail::batch_executor::for_each(count, firsts[count] / count, [&](size_t b)
+        {
+            m_buffers[b].gather_values(m_gathered.data() + firsts[b]);
+            m_buffers[b].reset();
+        },
+        max_threads);
+
+        support_type::sum_runs(m_gathered.data(), map.m_perm, map.m_runs, eng.values(), max_threads);
+    }
+
+  private:
+    size_type                   m_rows;
+    size_type                   m_cols;
+    std::vector<buffer_type>    m_buffers;
+    std::vector<T, AT>          m_gathered;     //- Values gathered by compress_values()
+
+    //- The position in the gathered list of the first element of each buffer, and the length
+    //  of the list.
+    //
+    std::vector<size_type>
+    list_firsts() const
+    {
+        std::vector<size_type>  firsts(m_buffers.size() + 1, 0);
+
+        for (size_type b = 0;  b < m_buffers.size();  ++b)
+        {
+            firsts[b + 1] = firsts[b] + m_buffers[b].size();
+        }
+        return firsts;
+    }
+
+    template<class LT>
+    engine_type<LT>
+    compress_pattern(sparse_scatter_map& map, bool keep_storage, size_t max_threads)
+    {
+        using engine_t = engine_type<LT>;
+
+        constexpr bool  row_major = is_same_v<LT, matrix_layout::row_major>;
+
+        size_type const     nmajor = (row_major) ? m_rows : m_cols;
+        size_type const     nminor = (row_major) ? m_cols : m_rows;
+
+        if (max_threads == 0)
+        {
+            max_threads = std::max(std::thread::hardware_concurrency(), 1u);
+        }
+
+        //- Gather the buffers into one list of keys and values, one buffer per invocation.
+        //
+        size_type const         count  = m_buffers.size();
+        std::vector<size_type>  firsts = list_firsts();
+        std::vector<key_type>   keys(firsts[count]);
+        std::vector<T, AT>      vals(firsts[count]);
+
+        map.m_rows      = m_rows;
+        map.m_cols      = m_cols;
+        map.m_row_major = row_major;
+        map.m_firsts    = firsts;
+
+        detail::batch_executor::for_each(count, firsts[count] / count, [&](size_t b)
+        {
+            m_buffers[b].template gather_keys<LT>(keys.data() + firsts[b]);
+            m_buffers[b].gather_values(vals.data() + firsts[b]);
+
+            if (keep_storage)
+            {
+                m_buffers[b].reset();
+            }
+            else
+            {
+                m_buffers[b].clear();
+            }
+        },
+        max_threads);
+
+        //- The symbolic phase, then the numeric phase.
+        //
+        typename engine_t::index_array_type     offsets;
+        typename engine_t::index_array_type     indices;
+        typename engine_t::element_array_type   values;
+
+        key_type const  max_key = (m_rows * m_cols == 0) ? 0 : static_cast<key_type>(m_rows * m_cols - 1);
+
+        support_type::sort(keys, map.m_perm, max_key, max_threads);
+        support_type::merge(keys, nmajor, nminor, offsets, indices, map.m_runs, max_threads);
+
+        keys = std::vector<key_type>();
+        values.resize(indices.size());
+        support_type::sum_runs(vals.data(), map.m_perm, map.m_runs, std::span<T>(values), max_threads);
+
+        return engine_t(m_rows, m_cols, std::move(offsets), std::move(indices), std::move(values));
+    }
+};
+
+}       //- STD_LA namespace
+#endif  //- LINEAR_ALGEBRA_SPARSE_ASSEMBLY_HPP_DEFINED
@@ -0,0 +1,439 @@
+//==================================================================================================
+//  File:       sparse_matrix_engine.hpp
+//
+//  Summary:    This header defines an owning, read-only engine that stores the non-zero elements
+//              of a sparse matrix in compressed sparse row (CSR) or column (CSC) form.
+//==================================================================================================
+//
+#ifndef LINEAR_ALGEBRA_SPARSE_MATRIX_ENGINE_HPP_DEFINED
+#define LINEAR_ALGEBRA_SPARSE_MATRIX_ENGINE_HPP_DEFINED
+
+namespace STD_LA {
+namespace detail {
+//--------------------------------------------------------------------------------------------------
+//  Concept:    valid_sparse_engine_arguments<T, IT, AT>
+//
+//  This private concept is used to validate the template arguments of sparse_matrix_engine.  The
+//  index type must be a non-boolean integral type, the allocator must be an allocator of T, and
+//  the layout must be row-major or column-major.
+//--------------------------------------------------------------------------------------------------
+//
+template<class T, class IT, class AT, class LT>
+concept valid_sparse_engine_arguments =
+    (std::is_integral_v<IT> and not same_as<IT, bool>)
+    and
+    valid_allocator_interface<T, AT>
+    and
+    valid_layout_for_storage_engine<LT>;
+
+template<class T, class AT, class IT>   struct spgemm_kernel;
+
+}       //- detail namespace
+
+
+//--------------------------------------------------------------------------------------------------
+//  Class Template:     sparse_matrix_engine<T, IT, AT, LT>
+//
+//  This class template implements an owning engine for use by class template matrix<ET, OT>.
+//  With the default row-major layout, it stores a matrix in compressed sparse row (CSR) form,
+//  using three arrays:
+//
+//      - row offsets, of length rows() + 1, where the non-zero elements of row i occupy the
+//        positions [offsets[i], offsets[i+1]) of the other two arrays;
+//      - column indices, of length nonzeros(), which are strictly increasing within each row;
+//      - values, of length nonzeros(), the elements themselves.
+//
+//  With a column-major layout, it stores the matrix in compressed sparse column (CSC) form
+//  instead, with the roles of rows and columns exchanged: column offsets, and row indices that
+//  are strictly increasing within each column.
+//
+//  Indices are stored as type IT, which may be narrower than size_t to reduce the memory traffic
+//  of products.  Elements are read by value, and those not stored read as zero; the engine is
+//  not writable through indexing, since assigning to an element might change the sparsity
+//  pattern; the stored values may be rewritten through values(), however.  A matrix of this
+//  engine is constructed from the three arrays, by compressing the non-zero elements of another
+//  matrix, or by a sparse_matrix_builder.
+//--------------------------------------------------------------------------------------------------
+//
+template<class T, class IT = size_t, class AT = std::allocator<T>,
+         class LT = matrix_layout::row_major>
+requires
+    detail::valid_sparse_engine_arguments<T, IT, AT, LT>
+class sparse_matrix_engine
+{
+    using this_type            = sparse_matrix_engine;
+    using index_allocator_type = typename std::allocator_traits<AT>::template rebind_alloc<IT>;
+
+    static constexpr bool   has_row_major_layout    = is_same_v<LT, matrix_layout::row_major>;
+    static constexpr bool   has_column_major_layout = is_same_v<LT, matrix_layout::column_major>;
+
+  public:
+    using element_type       = T;
+    using index_type         = IT;
+    using allocator_type     = AT;
+    using reference          = element_type;
+    using const_reference    = element_type;
+    using size_type          = size_t;
+    using index_array_type   = std::vector<IT, index_allocator_type>;
+    using element_array_type = std::vector<T, AT>;
+
+  public:
+    ~sparse_matrix_engine() = default;
+
+    //- Construct / assign.
+    //
+    constexpr sparse_matrix_engine()
+    :   m_rows(0), m_cols(0), m_offsets(1, IT{0}), m_indices(), m_values()
+    {}
+    constexpr sparse_matrix_engine(sparse_matrix_engine&&) noexcept = default;
+    constexpr sparse_matrix_engine(sparse_matrix_engine const&) = default;
+
+    constexpr sparse_matrix_engine&     operator =(sparse_matrix_engine&&) noexcept = default;
+    constexpr sparse_matrix_engine&     operator =(sparse_matrix_engine const&) = default;
+
+    //- Construction of a matrix of the given extents having no non-zero elements.
+    //
+    constexpr
+    sparse_matrix_engine(size_type rows, size_type cols)
+    :   m_rows(rows), m_cols(cols), m_offsets(major_extent(rows, cols) + 1, IT{0})
+    ,   m_indices(), m_values()
+    {
+        verify_index(minor_extent(rows, cols));
+    }
+
+    //- Construction from the three arrays described above, which are validated.  The offsets
+    //  are those of the rows for a CSR engine, and of the columns for a CSC engine.
+    //
+    constexpr
+    sparse_matrix_engine(size_type rows, size_type cols, index_array_type offsets,
+                         index_array_type indices, element_array_type values)
+    :   m_rows(rows)
+    ,   m_cols(cols)
+    ,   m_offsets(std::move(offsets))
+    ,   m_indices(std::move(indices))
+    ,   m_values(std::move(values))
+    {
+        verify_index(minor_extent(rows, cols));
+        verify_structure();
+    }
+
+    //- Construction by compressing the non-zero elements of another engine, row by row for a
+    //  CSR engine, and column by column for a CSC engine.
+    //
+    template<class ET2>
+    constexpr explicit
+    sparse_matrix_engine(ET2 const& rhs)
+    requires
+        detail::readable_matrix_engine<ET2>
+        and
+        detail::convertible_from<element_type, typename ET2::element_type>
+    :   m_rows(static_cast<size_type>(rhs.rows()))
+    ,   m_cols(static_cast<size_type>(rhs.columns()))
+    ,   m_offsets()
+    ,   m_indices()
+    ,   m_values()
+    {
+        using size_type_2 = typename ET2::size_type;
+
+        size_type const     nmajor = major_extent(m_rows, m_cols);
+        size_type const     nminor = minor_extent(m_rows, m_cols);
+
+        verify_index(nminor);
+        m_offsets.reserve(nmajor + 1);
+        m_offsets.push_back(IT{0});
+
+        for (size_type p = 0;  p < nmajor;  ++p)
+        {
+            for (size_type q = 0;  q < nminor;  ++q)
+            {
+                size_type const     i = (has_row_major_layout) ? p : q;
+                size_type const     j = (has_row_major_layout) ? q : p;
+                element_type const  e = static_cast<element_type>(
+                                            rhs(static_cast<size_type_2>(i), static_cast<size_type_2>(j)));
+                if (e != element_type{})
+                {
+                    m_indices.push_back(static_cast<IT>(q));
+                    m_values.push_back(e);
+                }
+            }
+            verify_index(m_values.size());
+            m_offsets.push_back(static_cast<IT>(m_values.size()));
+        }
+    }
+
+    //- Size and capacity reporting.
+    //
+    constexpr size_type
+    columns() const noexcept
+    {
+        return m_cols;
+    }
+
+    constexpr size_type
+    rows() const noexcept
+    {
+        return m_rows;
+    }
+
+    constexpr size_type
+    size() const noexcept
+    {
+        return m_rows * m_cols;
+    }
+
+    constexpr size_type
+    column_capacity() const noexcept
+    {
+        return m_cols;
+    }
+
+    constexpr size_type
+    row_capacity() const noexcept
+    {
+        return m_rows;
+    }
+
+    constexpr size_type
+    capacity() const noexcept
+    {
+        return m_rows * m_cols;
+    }
+
+    constexpr size_type
+    nonzeros() const noexcept
+    {
+        return m_values.size();
+    }
+
+    //- Element access.  An element is found by binary search of the indices of its row (or
+    //  column).
+    //
+    constexpr const_reference
+    operator ()(size_type i, size_type j) const
+    {
+        size_type const     p = (has_row_major_layout) ? i : j;
+        IT const            q = static_cast<IT>((has_row_major_layout) ? j : i);
+
+        auto const  first = m_indices.begin() + static_cast<ptrdiff_t>(m_offsets[p]);
+        auto const  last  = m_indices.begin() + static_cast<ptrdiff_t>(m_offsets[p + 1]);
+        auto const  pos   = std::lower_bound(first, last, q);
+
+        if (pos != last  &&  *pos == q)
+        {
+            return m_values[static_cast<size_type>(pos - m_indices.begin())];
+        }
+        return element_type{};
+    }
+
+    //- Access to the compressed arrays, for use by the sparse kernels.
+    //
+    constexpr std::span<IT const>
+    row_offsets() const noexcept
+    requires
+        this_type::has_row_major_layout
+    {
+        return std::span<IT const>(m_offsets.data(), m_offsets.size());
+    }
+
+    constexpr std::span<IT const>
+    column_indices() const noexcept
+    requires
+        this_type::has_row_major_layout
+    {
+        return std::span<IT const>(m_indices.data(), m_indices.size());
+    }
+
+    constexpr std::span<IT const>
+    column_offsets() const noexcept
+    requires
+        this_type::has_column_major_layout
+    {
+        return std::span<IT const>(m_offsets.data(), m_offsets.size());
+    }
+
+    constexpr std::span<IT const>
+    row_indices() const noexcept
+    requires
+        this_type::has_column_major_layout
+    {
+        return std::span<IT const>(m_indices.data(), m_indices.size());
+    }
+
+    constexpr std::span<T const>
+    values() const noexcept
+    {
+        return std::span<T const>(m_values.data(), m_values.size());
+    }
+
+    //- Access to the values for writing, which cannot change the sparsity pattern; e.g., to
+    //  compute new values of a matrix having the same pattern.
+    //
+    constexpr std::span<T>
+    values() noexcept
+    {
+        return std::span<T>(m_values.data(), m_values.size());
+    }
+
+    //- Other modifiers.
+    //
+    constexpr void
+    swap(sparse_matrix_engine& rhs) noexcept
+    {
+        std::swap(m_rows, rhs.m_rows);
+        std::swap(m_cols, rhs.m_cols);
+        m_offsets.swap(rhs.m_offsets);
+        m_indices.swap(rhs.m_indices);
+        m_values.swap(rhs.m_values);
+    }
+
+  private:
+    size_type           m_rows;
+    size_type           m_cols;
+    index_array_type    m_offsets;
+    index_array_type    m_indices;
+    element_array_type  m_values;
+
+    //- The extents of the compressed (major) and indexed (minor) dimensions.
+    //
+    static constexpr size_type
+    major_extent(size_type rows, size_type cols) noexcept
+    {
+        return (has_row_major_layout) ? rows : cols;
+    }
+
+    static constexpr size_type
+    minor_extent(size_type rows, size_type cols) noexcept
+    {
+        return (has_row_major_layout) ? cols : rows;
+    }
+
+    //- Ensure that an index or an offset can be represented by the index type.
+    //
+    static constexpr void
+    verify_index(size_type n)
+    {
+        if (n > static_cast<size_type>(std::numeric_limits<IT>::max()))
+        {
+            throw runtime_error("sparse matrix index out of range for index type");
+        }
+    }
+
+    constexpr void
+    verify_structure() const
+    {
+        size_type const     nmajor = major_extent(m_rows, m_cols);
+        size_type const     nminor = minor_extent(m_rows, m_cols);
+
+        bool    valid = (m_offsets.size() == nmajor + 1)  &&  (m_indices.size() == m_values.size())
+                     && (m_offsets.front() == IT{0})
+                     && (static_cast<size_type>(m_offsets.back()) == m_values.size());
+
+        //- The offsets must be checked before any index is read through them.
+        //
+        for (size_type p = 0;  valid  &&  p < nmajor;  ++p)
+        {
+            valid = (m_offsets[p] <= m_offsets[p + 1])  &&
+                    (static_cast<size_type>(m_offsets[p + 1]) <= m_values.size());
+        }
+
+        for (size_type p = 0;  valid  &&  p < nmajor;  ++p)
+        {
+            IT const    first = m_offsets[p];
+            IT const    last  = m_offsets[p + 1];
+
+            for (IT k = first;  valid  &&  k < last;  ++k)
+            {
+                IT const    q = m_indices[static_cast<size_type>(k)];
+
+                valid = is_valid_index(q, nminor)  &&
+                        (k == first  ||  m_indices[static_cast<size_type>(k - 1)] < q);
+            }
+        }
+
+        if (not valid)
+        {
+            throw runtime_error("invalid compressed sparse matrix structure");
+        }
+    }
+
+    static constexpr bool
+    is_valid_index(IT q, size_type n) noexcept
+    {
+        if constexpr (std::is_signed_v<IT>)
+        {
+            if (q < IT{0}) return false;
+        }
+        return static_cast<size_type>(q) < n;
+    }
+};
+
+
+//--------------------------------------------------------------------------------------------------
+//  Class:      sparse_product_pattern
+//
+//  This public type holds the result of the symbolic phase of a product of two sparse matrices:
+//  the extents and numbers of elements of the operands, the division of the rows of the product
+//  among the threads, and, when the operands have different compressed forms, the permutation
+//  that converts the second operand to the form of the first.  It is produced by spgemm(pattern,
+//  A, B), and used by spgemm_values(pattern, A, B, C) to recompute only the values of a product
+//  whose operands have the same sparsity patterns, as when a Galerkin product R*A*P is formed
+//  again after the values of A change, without bounding, sorting or allocating its rows.
+//--------------------------------------------------------------------------------------------------
+//
+class sparse_product_pattern
+{
+  public:
+    using size_type = size_t;
+
+  public:
+    sparse_product_pattern() = default;
+
+    size_type
+    columns() const noexcept
+    {
+        return m_cols;
+    }
+
+    size_type
+    rows() const noexcept
+    {
+        return m_rows;
+    }
+
+    //- The number of elements of the product.
+    //
+    size_type
+    nonzeros() const noexcept
+    {
+        return m_nnz;
+    }
+
+  private:
+    template<class T, class AT, class IT>
+    friend struct detail::spgemm_kernel;
+
+    size_type               m_rows  = 0;
+    size_type               m_cols  = 0;
+    size_type               m_inner = 0;
+    size_type               m_nnz_a = 0;
+    size_type               m_nnz_b = 0;
+    size_type               m_nnz   = 0;
+    bool                    m_row_major = true;
+    bool                    m_transposed = false;
+    std::vector<size_type>  m_first_rows;   //- The first row of each thread's chunk
+    std::vector<size_type>  m_offsets;      //- The converted second operand's offsets, indices,
+    std::vector<size_type>  m_indices;      //  and the position of each of its elements in
+    std::vector<size_type>  m_perm;         //  the second operand
+};
+
+
+namespace detail {
+//- A default-constructed sparse engine has extents of zero, which are not constexpr extents.
+//
+template<class T, class IT, class AT, class LT>
+struct has_runtime_extents<sparse_matrix_engine<T, IT, AT, LT>> : public true_type
+{};
+
+}       //- detail namespace
+}       //- STD_LA namespace
+#endif  //- LINEAR_ALGEBRA_SPARSE_MATRIX_ENGINE_HPP_DEFINED
@@ -88,3 +88,197 @@ TEST(Add, Constexpr)
     PRINT(xc7);
     PRINT(xc8);
 }
+
+TEST(Add, Lazy)
+{
+    using ldd = dynamic_matrix<double, lazy_matrix_operation_traits>;
+    using lfd = fixed_size_matrix<double, 3, 3, lazy_matrix_operation_traits>;
+
+    ldd     a(40, 30), b(40, 30), c(40, 30);
+
+    for (size_t i = 0;  i < a.rows();  ++i)
+    {
+        for (size_t j = 0;  j < a.columns();  ++j)
+        {
+            a(i, j) = 1.0 + i + 2*j;
+            b(i, j) = 0.5 * i - j;
+            c(i, j) = 3.0 - 0.25*i*j;
+        }
+    }
+
+    //- Element-wise operations return expressions, which are evaluated on assignment.
+    //
+    auto    e1 = a + b - 2.0*c;
+    EXPECT_TRUE(is_matrix_expression_engine_v<decltype(e1)::engine_type>);
+    EXPECT_FALSE(is_owning_engine_type_v<decltype(e1)::engine_type>);
+    EXPECT_EQ(e1.rows(), 40u);
+    EXPECT_EQ(e1.columns(), 30u);
+
+    ldd     r1 = e1;
+    ldd     r2 = (a - c*0.5) / 4.0;
+
+    for (size_t i = 0;  i < a.rows();  ++i)
+    {
+        for (size_t j = 0;  j < a.columns();  ++j)
+        {
+            EXPECT_EQ(r1(i, j), a(i, j) + b(i, j) - 2.0*c(i, j));
+            EXPECT_EQ(r2(i, j), (a(i, j) - c(i, j)*0.5) / 4.0);
+        }
+    }
+
+    //- Assignment to an existing matrix, and operands that are views.
+    //
+    r2 = a.t().t() + b;
+    EXPECT_EQ(r2, a + b);
+
+    //- Expressions of dense operands are evaluated from flat pointers to the rows (or columns)
+    //  of their operands when those are all contiguous, and otherwise element by element; the
+    //  results must be the same.
+    //
+    using lcd = matrix<matrix_storage_engine<double, std::dynamic_extent, std::dynamic_extent,
+                                             std::allocator<double>, matrix_layout::column_major>,
+                       lazy_matrix_operation_traits>;
+
+    static_assert(decltype(e1)::engine_type::has_flat_lines);
+    EXPECT_TRUE(e1.engine().flat_lines(false));
+    EXPECT_FALSE(e1.engine().flat_lines(true));
+
+    lcd     ac = a;
+    lcd     bc = b;
+    lcd     r3 = 0.5*ac - bc;
+    ldd     r4 = 0.5*ac - bc;
+    ldd     r5 = a.submatrix(1, 20, 2, 15) / 4.0 + b.submatrix(3, 20, 0, 15);
+
+    EXPECT_TRUE((0.5*ac - bc).engine().flat_lines(true));
+    EXPECT_FALSE((0.5*ac - bc).engine().flat_lines(false));
+    EXPECT_TRUE((a.submatrix(1, 20, 2, 15) + c.submatrix(3, 20, 0, 15)).engine().flat_lines(false));
+
+    for (size_t i = 0;  i < a.rows();  ++i)
+    {
+        for (size_t j = 0;  j < a.columns();  ++j)
+        {
+            EXPECT_EQ(r3(i, j), 0.5*a(i, j) - b(i, j));
+            EXPECT_EQ(r4(i, j), 0.5*a(i, j) - b(i, j));
+        }
+    }
+    for (size_t i = 0;  i < 20;  ++i)
+    {
+        for (size_t j = 0;  j < 15;  ++j)
+        {
+            EXPECT_EQ(r5(i, j), a(i + 1, j + 2) / 4.0 + b(i + 3, j));
+        }
+    }
+
+    //- Expressions are evaluated once when used as operands of a matrix/matrix product.
+    //
+    ldd     p1 = (a + b) * c.t();
+    ldd     s1 = a + b;
+    ldd     p2 = s1 * c.t();
+    EXPECT_FALSE(is_matrix_expression_engine_v<decltype((a + b) * c.t())::engine_type>);
+    EXPECT_EQ(p1, p2);
+
+    //- Fixed-size expressions report constexpr extents and may be evaluated at compile time.
+    //
+    constexpr auto  fn = []()
+    {
+        lfd     m1 = LST_33_1;
+        lfd     m2 = LST_33_2;
+        lfd     m3 = m2 - m1*2.0 + m1;
+        return m3;
+    };
+
+    constexpr lfd   f1 = fn();
+    constexpr lfd   f2 = LST_33_2;
+    constexpr lfd   f3 = LST_33_1;
+    static_assert(f1 == fixed_size_matrix<double, 3, 3>(f2 - f3));
+}
+
+TEST(Add, OperandViews)
+{
+    using cmd = matrix<matrix_storage_engine<double, std::dynamic_extent, std::dynamic_extent,
+                                             std::allocator<double>, matrix_layout::column_major>>;
+
+    dynamic_matrix<double>  a(13, 17), b(17, 13);
+    cmd                     c(13, 17);
+
+    for (size_t i = 0;  i < a.rows();  ++i)
+    {
+        for (size_t j = 0;  j < a.columns();  ++j)
+        {
+            a(i, j) = 1.0 + i + 2*j;
+            b(j, i) = 0.5 * i - j;
+            c(i, j) = 3.0 * i - 0.25 * j;
+        }
+    }
+
+    //- Transpose and negation views of dense engines are read through their spans, and the
+    //  results must match those computed element by element.
+    //
+    auto    check = [](auto const& m1, auto const& m2, auto const& r)
+    {
+        ASSERT_EQ(r.rows(), m1.rows());
+        ASSERT_EQ(r.columns(), m1.columns());
+
+        for (size_t i = 0;  i < r.rows();  ++i)
+        {
+            for (size_t j = 0;  j < r.columns();  ++j)
+            {
+                EXPECT_EQ(r(i, j), m1(i, j) + m2(i, j));
+            }
+        }
+    };
+
+    check(a, b.t(), a + b.t());
+    check(-a, b.t(), -a + b.t());
+    check(a, -b.t(), a + -b.t());
+    check(-a, -b.t(), -a + -b.t());
+    check(b.t(), -(-a), b.t() + -(-a));
+    check(-b, a.t(), -b + a.t());
+    check(a, c, a + c);
+    check(-c, b.t(), -c + b.t());
+
+    auto    r = a;
+
+    r += -b.t();
+    check(a, -b.t(), r);
+}
+
+TEST(Add, CompoundAssignment)
+{
+    dynamic_matrix<double>  a(13, 17), b(13, 17);
+
+    for (size_t i = 0;  i < a.rows();  ++i)
+    {
+        for (size_t j = 0;  j < a.columns();  ++j)
+        {
+            a(i, j) = 1.0 + i + 2*j;
+            b(i, j) = 0.5 * i - j;
+        }
+    }
+
+    auto    r1 = a;
+    auto    r2 = a;
+    auto    r3 = a.t();
+
+    r1 += b;
+    r2 += b.t().t();
+    EXPECT_EQ(r1, a + b);
+    EXPECT_EQ(r2, a + b);
+
+    r3 += b.t();
+    EXPECT_EQ(a, r1);
+
+    dynamic_matrix<double>  w(13, 16);
+    EXPECT_THROW(r1 += w, runtime_error);
+
+    constexpr fmf_33    m1 = LST_33_1;
+    constexpr fmf_33    m2 = LST_33_2;
+    constexpr fmf_33    m3 = []
+    {
+        fmf_33  m = LST_33_1;
+        m += fmf_33(LST_33_2);
+        return m;
+    }();
+
+    EXPECT_EQ(m3, m1 + m2);
+}
@@ -27,3 +27,57 @@ TEST(Div, Constexpr)
     PRINT(ms);
 
 }
+
+TEST(Div, CompoundAssignment)
+{
+    dmf     a(5, 7);
+
+    for (size_t i = 0;  i < a.rows();  ++i)
+    {
+        for (size_t j = 0;  j < a.columns();  ++j)
+        {
+            a(i, j) = 1.0f + i + 2*j;
+        }
+    }
+
+    dmf     r1 = a;
+    r1 /= 4.0f;
+    EXPECT_EQ(r1, a / 4.0f);
+
+    auto    r2 = r1.t();
+    r2 /= 0.5;
+    EXPECT_EQ(r1, a / 2.0f);
+
+    //- Integer elements are divided as they are by the binary operator, and not by a scalar
+    //  first truncated to the element type.
+    //
+    dynamic_matrix<int>     n1(3, 4);
+
+    for (size_t i = 0;  i < n1.rows();  ++i)
+    {
+        for (size_t j = 0;  j < n1.columns();  ++j)
+        {
+            n1(i, j) = static_cast<int>(1 + 2*i + j);
+        }
+    }
+
+    dynamic_matrix<int>     n2 = n1;
+    n2 /= 0.5;
+    EXPECT_EQ(n2, dynamic_matrix<int>(n1 / 0.5));
+    EXPECT_EQ(n2(1, 0), 6);
+
+    dynamic_matrix<int>     n3 = n1;
+    n3 /= 2;
+    EXPECT_EQ(n3, n1 / 2);
+    EXPECT_EQ(n3(1, 0), 1);
+
+    constexpr fmf_33    m1 = LST_33_1;
+    constexpr fmf_33    m2 = []
+    {
+        fmf_33  m = LST_33_1;
+        m /= 2;
+        return m;
+    }();
+
+    EXPECT_EQ(m2, m1 / 2.0f);
+}
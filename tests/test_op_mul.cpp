@@ -75,3 +75,1342 @@ TEST(Mul, Various)
     dynamic_row_vector<float>       v2(10);
     PRINT(v2);
 }
+
+template<class MT1, class MT2, class MT3>
+void
+check_product(MT1 const& m1, MT2 const& m2, MT3 const& m3)
+{
+    ASSERT_EQ(m3.rows(), m1.rows());
+    ASSERT_EQ(m3.columns(), m2.columns());
+
+    for (ptrdiff_t i = 0;  i < (ptrdiff_t) m3.rows();  ++i)
+    {
+        for (ptrdiff_t j = 0;  j < (ptrdiff_t) m3.columns();  ++j)
+        {
+            typename MT3::element_type  e{};
+
+            for (ptrdiff_t k = 0;  k < (ptrdiff_t) m1.columns();  ++k)
+            {
+                e += m1(i, k) * m2(k, j);
+            }
+            EXPECT_EQ(m3(i, j), e);
+        }
+    }
+}
+
+template<class MT>
+void
+fill_product_operand(MT& m, int seed)
+{
+    for (ptrdiff_t i = 0;  i < (ptrdiff_t) m.rows();  ++i)
+    {
+        for (ptrdiff_t j = 0;  j < (ptrdiff_t) m.columns();  ++j)
+        {
+            using elem_type = typename MT::element_type;
+
+            if constexpr (is_complex_v<elem_type>)
+            {
+                m(i, j) = elem_type((i*7 + j*3 + seed) % 11 - 5, (i*5 + j*2 + seed) % 7 - 3);
+            }
+            else
+            {
+                m(i, j) = static_cast<elem_type>((i*7 + j*3 + seed) % 11 - 5);
+            }
+        }
+    }
+}
+
+TEST(Mul, Blocked)
+{
+    using dmd    = dynamic_matrix<double>;
+    using dmd_cm = matrix<matrix_storage_engine<double, std::dynamic_extent, std::dynamic_extent,
+                                                std::allocator<double>, matrix_layout::column_major>>;
+    using dmcf   = dynamic_matrix<std::complex<float>>;
+
+    dmd     m1(67, 600);
+    dmd     m2(600, 45);
+    dmd_cm  m3(600, 45);
+    dmd     m4(45, 67);
+
+    fill_product_operand(m1, 1);
+    fill_product_operand(m2, 2);
+    fill_product_operand(m3, 3);
+    fill_product_operand(m4, 4);
+
+    check_product(m1, m2, m1 * m2);
+    check_product(m1, m3, m1 * m3);
+    check_product(m4.t(), m3.t(), m4.t() * m3.t());
+
+    dmf     f1(130, 90);
+    dmf     f2(90, 33);
+
+    fill_product_operand(f1, 5);
+    fill_product_operand(f2, 6);
+    check_product(f1, f2, f1 * f2);
+
+    dmcf    c1(21, 40);
+    dmcf    c2(40, 19);
+
+    fill_product_operand(c1, 7);
+    fill_product_operand(c2, 8);
+    check_product(c1, c2, c1 * c2);
+}
+
+#if defined(LA_SIMD_X86)
+
+template<class T>
+void
+check_simd_kernels()
+{
+    using kernel_type = gemm_kernel<T>;
+    using table_type  = simd_gemm_micro_kernel_table<T>;
+    using mat_type    = dynamic_matrix<T>;
+
+    mat_type    m1(53, 611);
+    mat_type    m2(611, 37);
+
+    fill_product_operand(m1, 1);
+    fill_product_operand(m2, 2);
+
+    for (simd_isa isa : {simd_isa::sse2, simd_isa::avx2, simd_isa::avx512})
+    {
+        if (not cpu_features::supports(isa)) continue;
+
+        mat_type    m3(53, 37);
+
+        kernel_type::multiply(T{1}, make_dense_operand(m1.span()), make_dense_operand(m2.span()),
+                              T{}, make_dense_operand(m3.span()),
+                              table_type::for_isa(isa, kernel_type::generic_micro_kernel()));
+        check_product(m1, m2, m3);
+    }
+}
+
+TEST(Mul, SimdKernels)
+{
+    check_simd_kernels<float>();
+    check_simd_kernels<double>();
+    check_simd_kernels<std::complex<float>>();
+    check_simd_kernels<std::complex<double>>();
+}
+
+template<class T>
+void
+check_simd_vector_kernels()
+{
+    using kernel_type = gemv_kernel<T>;
+    using table_type  = simd_vector_kernels<T>;
+
+    std::vector<T>  x(1003), y(1003);
+
+    for (size_t i = 0;  i < x.size();  ++i)
+    {
+        x[i] = static_cast<T>((i*7 + 1) % 11) - 5;
+        y[i] = static_cast<T>((i*3 + 2) % 13) - 6;
+    }
+
+    for (simd_isa isa : {simd_isa::sse2, simd_isa::avx2, simd_isa::avx512})
+    {
+        if (not cpu_features::supports(isa)) continue;
+
+        auto const  vk = table_type::for_isa(isa, {&kernel_type::generic_dot, &kernel_type::generic_axpy});
+
+        for (size_t n : {0u, 1u, 7u, 31u, 64u, 1003u})
+        {
+            EXPECT_EQ(vk.dot(n, x.data(), y.data()), kernel_type::generic_dot(n, x.data(), y.data()));
+
+            std::vector<T>  z1(y), z2(y);
+
+            vk.axpy(n, T{3}, x.data(), z1.data());
+            kernel_type::generic_axpy(n, T{3}, x.data(), z2.data());
+            EXPECT_EQ(z1, z2);
+        }
+    }
+}
+
+TEST(Mul, SimdVectorKernels)
+{
+    check_simd_vector_kernels<float>();
+    check_simd_vector_kernels<double>();
+}
+
+#endif
+
+TEST(Mul, Parallel)
+{
+    using pmd = dynamic_matrix<double, parallel_matrix_operation_traits>;
+
+    pmd     m1(150, 170);
+    pmd     m2(170, 130);
+
+    fill_product_operand(m1, 1);
+    fill_product_operand(m2, 2);
+
+    auto    m3 = m1 * m2;
+    EXPECT_TRUE((is_same_v<decltype(m3), pmd>));
+    check_product(m1, m2, m3);
+
+    for (size_t threads : {2u, 3u, 4u, 7u})
+    {
+        pmd     m4(150, 130);
+
+        gemm_kernel<double>::parallel_multiply(1.0, make_dense_operand(m1.span()),
+                                               make_dense_operand(m2.span()), 0.0,
+                                               make_dense_operand(m4.span()), threads);
+        check_product(m1, m2, m4);
+    }
+}
+
+TEST(Mul, Strassen)
+{
+    using smd = dynamic_matrix<double, strassen_matrix_operation_traits<16>>;
+    using smf = dynamic_matrix<float, strassen_matrix_operation_traits<16>>;
+
+    //- Operands whose elements are small integers give exact products, so that the results
+    //  of the Strassen-Winograd kernel may be compared exactly.  Odd sizes exercise peeling.
+    //
+    for (ptrdiff_t n : {10, 17, 64, 100, 143})
+    {
+        smd     m1(n, n);
+        smd     m2(n, n);
+
+        fill_product_operand(m1, 1);
+        fill_product_operand(m2, 2);
+
+        auto    m3 = m1 * m2;
+        EXPECT_TRUE((is_same_v<decltype(m3), smd>));
+        check_product(m1, m2, m3);
+        check_product(m1.t(), m2, m1.t() * m2);
+    }
+
+    smf     f1(77, 77);
+    smf     f2(77, 77);
+
+    fill_product_operand(f1, 3);
+    fill_product_operand(f2, 4);
+    check_product(f1, f2, f1 * f2);
+
+    //- Non-square products use the standard traits.
+    //
+    smd     r1(70, 90);
+    smd     r2(90, 50);
+
+    fill_product_operand(r1, 1);
+    fill_product_operand(r2, 2);
+    check_product(r1, r2, r1 * r2);
+
+    //- The kernel itself handles rectangular products.
+    //
+    dynamic_matrix<double>  r3(70, 50);
+    strassen_kernel<double>::multiply(make_dense_operand(r1.span()),
+                                      make_dense_operand(r2.span()),
+                                      make_dense_operand(r3.span()), 8);
+    check_product(r1, r2, r3);
+
+    EXPECT_EQ(strassen_kernel<double>::workspace_size(64, 64, 64, 16), 2u*32*32 + 2u*16*16);
+    EXPECT_EQ(strassen_kernel<double>::workspace_size(16, 64, 64, 16), 0u);
+}
+
+TEST(Mul, Complex)
+{
+    using cd    = std::complex<double>;
+    using dmcd  = dynamic_matrix<cd>;
+    using dmcf  = dynamic_matrix<std::complex<float>>;
+    using dmcd3 = dynamic_matrix<cd, complex_3m_matrix_operation_traits>;
+    using cmcd  = matrix<matrix_storage_engine<cd, std::dynamic_extent, std::dynamic_extent,
+                                               std::allocator<cd>, matrix_layout::column_major>>;
+
+    //- Elements having small integer parts give exact products, and the blocks of the complex
+    //  kernel are 256 x 256, so these products span several of them.
+    //
+    dmcd    m1(270, 300);
+    dmcd    m2(300, 260);
+    cmcd    m3(260, 300);
+
+    fill_product_operand(m1, 1);
+    fill_product_operand(m2, 2);
+    fill_product_operand(m3, 3);
+
+    check_product(m1, m2, m1 * m2);
+    check_product(m1, m3.t(), m1 * m3.t());
+    check_product(m1.conj(), m2, m1.conj() * m2);
+    check_product(m1, m3.h(), m1 * m3.h());
+    check_product(m3.h(), m1.conj().t(), m3.h() * m1.h());
+
+    dmcf    f1(40, 50);
+    dmcf    f2(50, 30);
+
+    fill_product_operand(f1, 4);
+    fill_product_operand(f2, 5);
+    check_product(f1, f2, f1 * f2);
+    check_product(f2.h(), f1.h(), f2.h() * f1.h());
+
+    //- The 3M algorithm.
+    //
+    dmcd3   t1(270, 300);
+    dmcd3   t2(300, 260);
+
+    fill_product_operand(t1, 1);
+    fill_product_operand(t2, 2);
+
+    auto    t3 = t1 * t2;
+    EXPECT_TRUE((is_same_v<decltype(t3), dmcd3>));
+    check_product(t1, t2, t3);
+    check_product(t1.conj(), t2, t1.conj() * t2);
+
+    //- General alpha and beta, through the kernel and gemm().
+    //
+    for (auto algo : {complex_gemm_algorithm::four_m, complex_gemm_algorithm::three_m})
+    {
+        dmcd    c(270, 260);
+        fill_product_operand(c, 6);
+
+        auto    c0 = c;
+        cd      al(2, -1);
+        cd      be(0, 3);
+
+        split_complex_gemm_kernel<cd>::multiply(al, make_view_operand(m1.conj().span()),
+                                          make_view_operand(m2.span()), be,
+                                          make_dense_operand(c.span()), algo);
+        EXPECT_EQ(c, al * (m1.conj() * m2) + be * c0);
+    }
+
+    dmcd    c(270, 260);
+    fill_product_operand(c, 6);
+
+    auto    c0 = c;
+    gemm(cd(0, 1), m1, m2.conj(), cd(-1), c);
+    EXPECT_EQ(c, cd(0, 1) * (m1 * m2.conj()) - c0);
+}
+
+TEST(Mul, OperandViews)
+{
+    using cd   = std::complex<double>;
+    using dmd  = dynamic_matrix<double>;
+    using dmcd = dynamic_matrix<cd>;
+
+    //- Transpose, negation, conjugate, and hermitian views, and views of them, are unwrapped
+    //  into a span of the viewed engine and a pair of flags.
+    //
+    dmd     a(200, 150);
+    dmd     b(200, 160);
+    dmcd    c(120, 90);
+    dmcd    d(120, 100);
+
+    fill_product_operand(a, 1);
+    fill_product_operand(b, 2);
+    fill_product_operand(c, 3);
+    fill_product_operand(d, 4);
+
+    using neg_traits  = operand_mdspan_traits<decltype((-a.t()).span())>;
+    using pos_traits  = operand_mdspan_traits<decltype((-(-a)).span())>;
+    using herm_traits = operand_mdspan_traits<decltype((-c.h()).span())>;
+    using conj_traits = operand_mdspan_traits<decltype(c.conj().conj().span())>;
+
+    EXPECT_TRUE(neg_traits::direct  &&  neg_traits::negated  &&  !neg_traits::conjugated);
+    EXPECT_TRUE(pos_traits::direct  &&  !pos_traits::negated  &&  !pos_traits::conjugated);
+    EXPECT_TRUE(herm_traits::direct  &&  herm_traits::negated  &&  herm_traits::conjugated);
+    EXPECT_TRUE(conj_traits::direct  &&  !conj_traits::negated  &&  !conj_traits::conjugated);
+
+    //- The elements have small integer values, so these products are exact.
+    //
+    check_product(a.t(), a, a.t() * a);
+    check_product(-a.t(), b, -a.t() * b);
+    check_product(a.t(), -b, a.t() * -b);
+    check_product(-a.t(), -b, -a.t() * -b);
+    check_product(-c.h(), d, -c.h() * d);
+    check_product(c.h(), -d.conj(), c.h() * -d.conj());
+    check_product(-(-c.t()), d, -(-c.t()) * d);
+
+    dynamic_matrix<cd, complex_3m_matrix_operation_traits>  e(120, 100);
+
+    fill_product_operand(e, 5);
+    check_product(-c.h(), e, -c.h() * e);
+
+    //- Matrix-vector products through the vector kernels.
+    //
+    dynamic_column_vector<double>   x(200);
+
+    fill_product_operand(x, 6);
+    check_product(-a.t(), x, -a.t() * x);
+    check_product(-x.t(), b, -x.t() * b);
+    check_product(-x.t(), -x, -x.t() * -x);
+
+    //- General alpha and beta, through gemm().
+    //
+    dmd     r(150, 160);
+    fill_product_operand(r, 7);
+
+    auto    r0 = r;
+    gemm(2.0, -a.t(), b, -1.0, r);
+    EXPECT_EQ(r, 2.0 * (-a.t() * b) - r0);
+}
+
+TEST(Mul, Symmetric)
+{
+    using cd   = std::complex<double>;
+    using dmd  = dynamic_matrix<double>;
+    using dmcd = dynamic_matrix<cd>;
+
+    dmd     a(300, 170);
+    dmcd    c(200, 90);
+
+    fill_product_operand(a, 1);
+    fill_product_operand(c, 2);
+
+    auto const  is_symmetric = [](auto const& m, bool herm)
+    {
+        for (size_t i = 0;  i < m.rows();  ++i)
+        {
+            for (size_t j = 0;  j < m.columns();  ++j)
+            {
+                auto const  e = (herm) ? std::conj(cd(m(j, i))) : cd(m(j, i));
+                if (cd(m(i, j)) != e) return false;
+            }
+        }
+        return true;
+    };
+
+    //- Products of an operand with its own transpose are recognized, and computed by way of
+    //  one triangle; the elements have small integer values, so the products are exact.
+    //
+    auto    g1 = a * a.t();
+    auto    g2 = a.t() * a;
+    auto    h1 = c * c.h();
+    auto    h2 = c.h() * c;
+    auto    s1 = c * c.t();
+    auto    h3 = -c * c.h();
+
+    check_product(a, a.t(), g1);
+    check_product(a.t(), a, g2);
+    check_product(c, c.h(), h1);
+    check_product(c.h(), c, h2);
+    check_product(c, c.t(), s1);
+    check_product(-c, c.h(), h3);
+    EXPECT_TRUE(is_symmetric(g1, false));
+    EXPECT_TRUE(is_symmetric(g2, false));
+    EXPECT_TRUE(is_symmetric(h1, true));
+    EXPECT_TRUE(is_symmetric(h2, true));
+    EXPECT_TRUE(is_symmetric(s1, false));
+    EXPECT_TRUE(is_symmetric(h3, true));
+
+    //- A complex alpha makes the product neither symmetric nor Hermitian.
+    //
+    dmcd    r;
+    gemm(cd(0, 1), c, c.h(), cd(0), r);
+    EXPECT_EQ(r, cd(0, 1) * h1);
+
+    //- The explicit functions, with and without a prior value of C, which must itself be
+    //  symmetric (or Hermitian).
+    //
+    dmd     t;
+    syrk(2.0, a, 0.0, t);
+    EXPECT_EQ(t, 2.0 * g1);
+
+    syrk(1.0, a.t(), 0.0, t);
+    EXPECT_EQ(t, g2);
+    syrk(-1.0, a.t(), 3.0, t);
+    EXPECT_EQ(t, 2.0 * g2);
+
+    dmcd    u;
+    herk(1.0, c, 0.0, u);
+    EXPECT_EQ(u, h1);
+    herk(1.0, c, 2.0, u);
+    EXPECT_EQ(u, 3.0 * h1);
+
+    //- The result depends only on the lower triangle of a prior value of C, whether C is small
+    //  enough to be computed by the full product or is computed in blocks.
+    //
+    auto    poison_upper = [](auto& m)
+    {
+        for (size_t i = 0;  i < m.rows();  ++i)
+        {
+            for (size_t j = i + 1;  j < m.columns();  ++j)
+            {
+                m(i, j) = std::numeric_limits<double>::quiet_NaN();
+            }
+        }
+    };
+
+    t = g1;
+    poison_upper(t);
+    syrk(-1.0, a, 3.0, t);
+    EXPECT_EQ(t, 2.0 * g1);
+
+    dmd     ws(40, 40);
+    dmd     w0(40, 30);
+    fill_product_operand(w0, 3);
+    ws = w0 * w0.t();
+    poison_upper(ws);
+    syrk(1.0, w0, 1.0, ws);
+    EXPECT_EQ(ws, 2.0 * (w0 * w0.t()));
+
+    dmd     w(8, 5);
+    dmd     wt;
+    fill_product_operand(w, 3);
+    syrk(1.0, w, 0.0, wt);
+    check_product(w, w.t(), wt);
+
+    dmcd    v(7, 6);
+    dmcd    vt;
+    fill_product_operand(v, 4);
+    herk(1.0, v, 0.0, vt);
+    check_product(v, v.h(), vt);
+    herk(1.0, v.h(), 0.0, vt);
+    check_product(v.h(), v, vt);
+
+    //- A result that overlaps its operand is computed in a temporary.
+    //
+    dmd     x = a.submatrix(0, 150, 0, 150);
+    syrk(1.0, x, 0.0, x);
+    EXPECT_EQ(x, a.submatrix(0, 150, 0, 150) * a.submatrix(0, 150, 0, 150).t());
+
+    constexpr fmf_33    m1 = LST_33_1;
+    constexpr fmf_33    m2 = []
+    {
+        fmf_33  m;
+        syrk(1.0f, fmf_33(LST_33_1), 0.0f, m);
+        return m;
+    }();
+
+    EXPECT_EQ(m2, m1 * m1.t());
+}
+
+TEST(Mul, Accumulator)
+{
+    using wmf    = dynamic_matrix<float, wide_accumulation_matrix_operation_traits>;
+    using wmf_33 = fixed_size_matrix<float, 3, 3, wide_accumulation_matrix_operation_traits>;
+
+    static_assert(is_same_v<multiplication_accumulator_t<multiplication_element_traits<void, float, float>>,
+                            float>);
+    static_assert(is_same_v<multiplication_accumulator_t<wide_multiplication_element_traits<void, float, float>>,
+                            double>);
+
+    //- Each row of A holds a large element, a run of ones, and the negation of the large
+    //  element.  Summed in float, the ones are lost against the large element; summed in
+    //  double, they are not.
+    //
+    auto    fill = [](auto& a)
+    {
+        for (ptrdiff_t i = 0;  i < (ptrdiff_t) a.rows();  ++i)
+        {
+            for (ptrdiff_t j = 0;  j < (ptrdiff_t) a.columns();  ++j)
+            {
+                a(i, j) = (j == 0) ? 1.0e8f : (j == (ptrdiff_t) a.columns() - 1) ? -1.0e8f : 1.0f;
+            }
+        }
+    };
+
+    dmf     a1(20, 300);
+    wmf     a2(20, 300);
+    wmf     b2(300, 20);
+
+    fill(a1);
+    fill(a2);
+    for (ptrdiff_t i = 0;  i < 300;  ++i)
+        for (ptrdiff_t j = 0;  j < 20;  ++j)
+            b2(i, j) = 1.0f;
+
+    auto    r1 = a1 * dmf(b2);
+    auto    r2 = a2 * b2;
+    auto    r3 = a2.t().t() * b2.column(3);
+
+    EXPECT_TRUE((is_same_v<decltype(r2), wmf>));
+    EXPECT_NE(r1(0, 0), 298.0f);
+    EXPECT_EQ(r2(0, 0), 298.0f);
+    EXPECT_EQ(r2(19, 19), 298.0f);
+    EXPECT_EQ(r3(7, 0), 298.0f);
+
+    //- The loop nest, for operands that do not expose their elements directly.
+    //
+    auto    r4 = (-a2) * b2;
+    EXPECT_EQ(r4(5, 5), -298.0f);
+
+    //- gemm() uses the accumulator type of the result's traits.
+    //
+    wmf     c(20, 20);
+    gemm(1.0f, a1, dmf(b2), 0.0f, c);
+    EXPECT_EQ(c(0, 0), 298.0f);
+
+    gemm(2.0f, a1, dmf(b2), -1.0f, c);
+    EXPECT_EQ(c(3, 4), 298.0f);
+
+    //- Fixed-size products.
+    //
+    wmf_33  f1 = {{1.0e8f, 1.0f, -1.0e8f}, {1.0f, 1.0e8f, -1.0e8f}, {1.0f, 2.0f, 3.0f}};
+    wmf_33  f2 = {{1.0f, 0.0f, 0.0f}, {1.0f, 1.0f, 0.0f}, {1.0f, 0.0f, 1.0f}};
+    auto    f3 = f1 * f2;
+
+    EXPECT_EQ(f3(0, 0), 1.0f);
+    EXPECT_EQ(f3(1, 0), 1.0f);
+    EXPECT_EQ(f3(2, 0), 6.0f);
+}
+
+TEST(Mul, LayoutOrder)
+{
+    using rmf = matrix<matrix_storage_engine<float, std::dynamic_extent, std::dynamic_extent,
+                                             std::allocator<float>, matrix_layout::row_major>>;
+    using cmf = matrix<matrix_storage_engine<float, std::dynamic_extent, std::dynamic_extent,
+                                             std::allocator<float>, matrix_layout::column_major>>;
+    using rmd = matrix<matrix_storage_engine<double, std::dynamic_extent, std::dynamic_extent,
+                                             std::allocator<double>, matrix_layout::row_major>>;
+    using cmd = matrix<matrix_storage_engine<double, std::dynamic_extent, std::dynamic_extent,
+                                             std::allocator<double>, matrix_layout::column_major>>;
+
+    rmf     r1(23, 31);
+    cmf     c1(23, 31);
+    rmd     r2(31, 17);
+    cmd     c2(31, 17);
+
+    fill_product_operand(r1, 1);
+    fill_product_operand(c1, 1);
+    fill_product_operand(r2, 2);
+    fill_product_operand(c2, 2);
+
+    auto    p1 = r1 * r2;
+    auto    p2 = r1 * c2;
+    auto    p3 = c1 * r2;
+    auto    p4 = c1 * c2;
+
+    EXPECT_TRUE((is_same_v<get_layout_t<decltype(p1)::engine_type>, matrix_layout::row_major>));
+    EXPECT_TRUE((is_same_v<get_layout_t<decltype(p2)::engine_type>, matrix_layout::column_major>));
+    EXPECT_TRUE((is_same_v<get_layout_t<decltype(p3)::engine_type>, matrix_layout::row_major>));
+    EXPECT_TRUE((is_same_v<get_layout_t<decltype(p4)::engine_type>, matrix_layout::column_major>));
+
+    check_product(r1, r2, p1);
+    check_product(r1, c2, p2);
+    check_product(c1, r2, p3);
+    check_product(c1, c2, p4);
+    check_product(-r1, c2.t().t(), -r1 * c2.t().t());
+}
+
+template<class T, size_t R, size_t K, size_t C>
+void
+check_fixed_size_product()
+{
+    fixed_size_matrix<T, R, K>  m1;
+    fixed_size_matrix<T, K, C>  m2;
+
+    fill_product_operand(m1, 1);
+    fill_product_operand(m2, 2);
+
+    auto    m3 = m1 * m2;
+    EXPECT_TRUE((is_same_v<decltype(m3), fixed_size_matrix<T, R, C>>));
+    check_product(m1, m2, m3);
+    check_product(m2.t(), m1.t(), m2.t() * m1.t());
+}
+
+TEST(Mul, FixedSize)
+{
+    check_fixed_size_product<float, 4, 4, 4>();
+    check_fixed_size_product<float, 8, 8, 8>();
+    check_fixed_size_product<float, 3, 5, 8>();
+    check_fixed_size_product<double, 3, 3, 3>();
+    check_fixed_size_product<double, 2, 7, 2>();
+    check_fixed_size_product<double, 4, 4, 4>();
+    check_fixed_size_product<std::complex<double>, 2, 3, 4>();
+
+    constexpr fmf_44    m1 = LST_44_1;
+    constexpr fmf_44    m2 = LST_44_2;
+    constexpr fmf_44    m3 = m1 * m2;
+    fmf_44              m4 = m1;
+
+    m4 = m4 * m2;
+    EXPECT_EQ(m3, m4);
+
+    constexpr fmf_44    m5 = (m1 + m2) - (2.0f * m1) / 2.0f;
+    EXPECT_EQ(m5, m2);
+}
+
+TEST(Mul, Vector)
+{
+    using cmd = matrix<matrix_storage_engine<double, std::dynamic_extent, std::dynamic_extent,
+                                             std::allocator<double>, matrix_layout::column_major>>;
+
+    dynamic_matrix<double>          a(37, 53);
+    cmd                             c(37, 53);
+    dynamic_column_vector<double>   x(53);
+    dynamic_row_vector<double>      r(37);
+
+    fill_product_operand(a, 1);
+    fill_product_operand(c, 2);
+    fill_product_operand(x, 3);
+    fill_product_operand(r, 4);
+
+    check_product(a, x, a * x);
+    check_product(c, x, c * x);
+    check_product(r, a, r * a);
+    check_product(r, c, r * c);
+    check_product(a.t(), r.t(), a.t() * r.t());
+    check_product(c.t(), r.t(), c.t() * r.t());
+    check_product(x.t(), a.t(), x.t() * a.t());
+
+    auto    d = r * (a * x);
+
+    EXPECT_EQ(d.rows(), 1);
+    EXPECT_EQ(d.columns(), 1);
+    check_product(r, a * x, d);
+
+    fixed_size_matrix<float, 20, 20>    f;
+    fixed_size_column_vector<float, 20> fx;
+    fixed_size_row_vector<float, 20>    fr;
+
+    fill_product_operand(f, 5);
+    fill_product_operand(fx, 6);
+    fill_product_operand(fr, 7);
+
+    check_product(f, fx, f * fx);
+    check_product(fr, f, fr * f);
+    check_product(fr, fx, fr * fx);
+
+    constexpr fmf_44    m1 = LST_44_1;
+    constexpr auto      v1 = m1 * m1.column(1);
+    constexpr auto      v2 = m1.row(2) * m1;
+
+    check_product(m1, m1.column(1), v1);
+    check_product(m1.row(2), m1, v2);
+}
+
+TEST(Mul, Gemm)
+{
+    using cmd = matrix<matrix_storage_engine<double, std::dynamic_extent, std::dynamic_extent,
+                                             std::allocator<double>, matrix_layout::column_major>>;
+
+    dynamic_matrix<double>  a(37, 53);
+    dynamic_matrix<double>  b(53, 41);
+    dynamic_matrix<double>  c0(37, 41);
+    cmd                     a2(5, 3);
+    cmd                     b2(3, 4);
+
+    fill_product_operand(a, 1);
+    fill_product_operand(b, 2);
+    fill_product_operand(c0, 3);
+    fill_product_operand(a2, 4);
+    fill_product_operand(b2, 5);
+
+    //- C = A*B into an empty matrix, which is resized to fit, and then again into the same
+    //  storage without reallocation.
+    //
+    dynamic_matrix<double>  c;
+
+    gemm(1, a, b, 0, c);
+    check_product(a, b, c);
+
+    double const*   p = c.span().data_handle();
+
+    gemm(1.0, a, b, 0.0, c);
+    check_product(a, b, c);
+    EXPECT_EQ(c.span().data_handle(), p);
+
+    //- A smaller product, and then the larger one again, within the same storage.
+    //
+    gemm(1.0, a.submatrix(0, 20, 0, 53), b.submatrix(0, 53, 0, 30), 0.0, c);
+    EXPECT_EQ(c.rows(), 20);
+    EXPECT_EQ(c.columns(), 30);
+    gemm(1.0, a, b, 0.0, c);
+    check_product(a, b, c);
+    EXPECT_EQ(c.span().data_handle(), p);
+
+    //- C = alpha*A*B + beta*C, by both the packed kernel and the loop nests.
+    //
+    auto    ab = a * b;
+
+    c = c0;
+    gemm(2.0, a, b, -3.0, c);
+    EXPECT_EQ(c, 2.0*ab - 3.0*c0);
+
+    auto    ab2 = a2 * b2;
+    cmd     c2(5, 4);
+
+    fill_product_operand(c2, 6);
+    auto    c3 = c2;
+    gemm(-1.0, a2, b2, 2.0, c2);
+    EXPECT_EQ(c2, 2.0*c3 - ab2);
+
+    fixed_size_matrix<float, 5, 4>  fc;
+    fill_product_operand(fc, 7);
+    auto    fd = fc;
+    gemm(1.0f, a2, b2, 1.0f, fc);
+
+    for (ptrdiff_t i = 0;  i < 5;  ++i)
+    {
+        for (ptrdiff_t j = 0;  j < 4;  ++j)
+        {
+            EXPECT_EQ(fc(i, j), fd(i, j) + static_cast<float>(ab2(i, j)));
+        }
+    }
+
+    //- Mis-matched extents are errors when C cannot be resized or must be read.
+    //
+    dynamic_matrix<double>  c4(3, 3);
+    EXPECT_THROW(gemm(1.0, a, a, 0.0, c), runtime_error);
+    EXPECT_THROW(gemm(1.0, a, b, 1.0, c4), runtime_error);
+    EXPECT_THROW(gemm(1.0, a2, a2.t(), 0.0, fc), runtime_error);
+}
+
+TEST(Mul, GemmBatched)
+{
+    using dmd = dynamic_matrix<double>;
+
+    size_t const    count = 150;
+
+    vector<dmd>     a(count, dmd(16, 24));
+    vector<dmd>     b(count, dmd(24, 20));
+    vector<dmd>     c0(count, dmd(16, 20));
+
+    for (size_t p = 0;  p < count;  ++p)
+    {
+        fill_product_operand(a[p], (int) p);
+        fill_product_operand(b[p], (int) p + 1);
+        fill_product_operand(c0[p], (int) p + 2);
+    }
+
+    //- C[p] = A[p]*B[p] into empty matrices, which are resized to fit, and then again into the
+    //  same storage without reallocation, serially and in parallel.
+    //
+    vector<dmd>     c(count);
+
+    gemm_batched(1, a, b, 0, c);
+
+    for (size_t p = 0;  p < count;  ++p)
+    {
+        check_product(a[p], b[p], c[p]);
+    }
+
+    double const*   p0 = c[0].span().data_handle();
+
+    for (size_t threads : {1u, 3u, 4u})
+    {
+        gemm_batched(1.0, a, b, 0.0, c, threads);
+
+        for (size_t p = 0;  p < count;  ++p)
+        {
+            check_product(a[p], b[p], c[p]);
+        }
+        EXPECT_EQ(c[0].span().data_handle(), p0);
+    }
+
+    //- C[p] = alpha*A[p]*B[p] + beta*C[p], over spans of the batches.
+    //
+    c = c0;
+    gemm_batched(2.0, span<dmd const>(a), span<dmd const>(b), -3.0, span<dmd>(c), 4);
+
+    for (size_t p = 0;  p < count;  ++p)
+    {
+        EXPECT_EQ(c[p], 2.0*(a[p]*b[p]) - 3.0*c0[p]);
+    }
+
+    //- Products having small, fixed extents.
+    //
+    vector<fmf_33>  f1(count);
+    vector<fmf_33>  f2(count);
+    vector<fmf_33>  f3(count);
+
+    for (size_t p = 0;  p < count;  ++p)
+    {
+        fill_product_operand(f1[p], (int) p);
+        fill_product_operand(f2[p], (int) p + 1);
+        fill_product_operand(f3[p], (int) p + 2);
+    }
+
+    vector<fmf_33>  f4 = f3;
+
+    gemm_batched(1.0f, f1, f2, 0.0f, f4);
+    for (size_t p = 0;  p < count;  ++p)
+    {
+        check_product(f1[p], f2[p], f4[p]);
+    }
+
+    f4 = f3;
+    gemm_batched(2.0f, f1, f2, 1.0f, f4);
+    for (size_t p = 0;  p < count;  ++p)
+    {
+        EXPECT_EQ(f4[p], 2.0f*(f1[p]*f2[p]) + f3[p]);
+    }
+
+    //- Results that overlap their operands are computed in a temporary.
+    //
+    vector<dmd>     s1(10, dmd(20, 20));
+    vector<dmd>     s2(10, dmd(20, 20));
+
+    for (size_t p = 0;  p < s1.size();  ++p)
+    {
+        fill_product_operand(s1[p], (int) p);
+        fill_product_operand(s2[p], (int) p + 1);
+    }
+
+    vector<dmd>     s3 = s1;
+
+    gemm_batched(1.0, s3, s2, 0.0, s3);
+    for (size_t p = 0;  p < s1.size();  ++p)
+    {
+        check_product(s1[p], s2[p], s3[p]);
+    }
+
+    //- Batches held in rank-3 mdspans, indexed by (batch, row, column), of different layouts.
+    //
+    using ext3 = extents<size_t, dynamic_extent, dynamic_extent, dynamic_extent>;
+
+    vector<double>  da(count * 16 * 24);
+    vector<double>  db(count * 24 * 20);
+    vector<double>  dc(count * 16 * 20);
+
+    mdspan<double, ext3, layout_left>   ma(da.data(), count, 16, 24);
+    mdspan<double, ext3>                mb(db.data(), count, 24, 20);
+    mdspan<double, ext3>                mc(dc.data(), count, 16, 20);
+
+    for (size_t p = 0;  p < count;  ++p)
+    {
+        for (size_t i = 0;  i < 16;  ++i)
+        {
+            for (size_t k = 0;  k < 24;  ++k) ma(p, i, k) = a[p](i, k);
+        }
+        for (size_t k = 0;  k < 24;  ++k)
+        {
+            for (size_t j = 0;  j < 20;  ++j) mb(p, k, j) = b[p](k, j);
+        }
+        for (size_t i = 0;  i < 16;  ++i)
+        {
+            for (size_t j = 0;  j < 20;  ++j) mc(p, i, j) = c0[p](i, j);
+        }
+    }
+
+    gemm_batched(2.0, mdspan<double const, ext3, layout_left>(ma), mb, -3.0, mc);
+
+    for (size_t p = 0;  p < count;  ++p)
+    {
+        auto const  e = 2.0*(a[p]*b[p]) - 3.0*c0[p];
+
+        for (size_t i = 0;  i < 16;  ++i)
+        {
+            for (size_t j = 0;  j < 20;  ++j)
+            {
+                EXPECT_EQ(mc(p, i, j), e(i, j));
+            }
+        }
+    }
+
+    //- Batches of different sizes, and operands of different extents, are errors.
+    //
+    vector<dmd>     b2 = b;
+
+    b2[7] = dmd(24, 21);
+    EXPECT_THROW(gemm_batched(1.0, a, vector<dmd>(count - 1, dmd(24, 20)), 0.0, c), runtime_error);
+    EXPECT_THROW(gemm_batched(1.0, a, b2, 0.0, c), runtime_error);
+    EXPECT_THROW(gemm_batched(1.0, ma, mc, 0.0, mc), runtime_error);
+}
+
+TEST(Mul, BatchElement)
+{
+    using bf8    = batch_element<float, 8>;
+    using fbf_33 = fixed_size_matrix<bf8, 3, 3>;
+    using fbf_34 = fixed_size_matrix<bf8, 3, 4>;
+    using fbf_43 = fixed_size_matrix<bf8, 4, 3>;
+
+    static_assert(writable_matrix_engine<fbf_33::engine_type>);
+    static_assert(sizeof(bf8) == 32  &&  alignof(bf8) == 32);
+    static_assert(default_batch_size_v<float> == 8  &&  default_batch_size_v<double> == 4);
+
+    //- Lane p of each batch holds an ordinary matrix, and every operation on the batch must
+    //  give the same result, lane by lane, as on the ordinary matrices.
+    //
+    fbf_34          b1;
+    fbf_43          b2;
+    fbf_33          b3;
+    vector<fmf_34>  f1(bf8::size());
+    vector<fmf_43>  f2(bf8::size());
+    vector<fmf_33>  f3(bf8::size());
+
+    for (size_t p = 0;  p < bf8::size();  ++p)
+    {
+        fill_product_operand(f1[p], (int) p);
+        fill_product_operand(f2[p], (int) p + 1);
+        fill_product_operand(f3[p], (int) p + 2);
+
+        for (ptrdiff_t i = 0;  i < 3;  ++i)
+        {
+            for (ptrdiff_t j = 0;  j < 4;  ++j)
+            {
+                b1(i, j)[p] = f1[p](i, j);
+                b2(j, i)[p] = f2[p](j, i);
+            }
+            for (ptrdiff_t j = 0;  j < 3;  ++j)
+            {
+                b3(i, j)[p] = f3[p](i, j);
+            }
+        }
+    }
+
+    fbf_33  r1 = b1 * b2;
+    fbf_33  r2 = r1 + b3;
+    fbf_33  r3 = 2.0f * r2 - b3 * 0.5f;
+    fbf_33  r4 = b3;
+
+    r4 *= b3;
+    EXPECT_EQ(r1, b1 * b2);
+
+    for (size_t p = 0;  p < bf8::size();  ++p)
+    {
+        fmf_33  e1 = f1[p] * f2[p];
+        fmf_33  e2 = e1 + f3[p];
+        fmf_33  e3 = 2.0f * e2 - f3[p] * 0.5f;
+        fmf_33  e4 = f3[p] * f3[p];
+
+        for (ptrdiff_t i = 0;  i < 3;  ++i)
+        {
+            for (ptrdiff_t j = 0;  j < 3;  ++j)
+            {
+                EXPECT_EQ(r1(i, j)[p], e1(i, j));
+                EXPECT_EQ(r2(i, j)[p], e2(i, j));
+                EXPECT_EQ(r3(i, j)[p], e3(i, j));
+                EXPECT_EQ(r4(i, j)[p], e4(i, j));
+            }
+        }
+    }
+}
+
+TEST(Mul, AxpyScale)
+{
+    using cmd = matrix<matrix_storage_engine<double, std::dynamic_extent, std::dynamic_extent,
+                                             std::allocator<double>, matrix_layout::column_major>>;
+
+    dynamic_matrix<double>  x(19, 23);
+    dynamic_matrix<double>  y(19, 23);
+    cmd                     z(19, 23);
+
+    fill_product_operand(x, 1);
+    fill_product_operand(y, 2);
+    fill_product_operand(z, 3);
+
+    auto    y0 = y;
+    auto    z0 = z;
+
+    axpy(3, x, y);
+    EXPECT_EQ(y, 3.0*x + y0);
+
+    axpy(-2.0, x, z);
+    EXPECT_EQ(z, z0 - 2.0*x);
+
+    auto    y1 = y0;
+    auto    yt = y1.t();
+
+    axpy(1.0, x.t(), yt);
+    EXPECT_EQ(y1, y0 + x);
+
+    scale(2, y);
+    EXPECT_EQ(y, 2.0*(3.0*x + y0));
+
+    scale(0.5, z);
+    EXPECT_EQ(z, (z0 - 2.0*x) / 2.0);
+
+    dynamic_matrix<double>  w(19, 22);
+    EXPECT_THROW(axpy(1.0, x, w), runtime_error);
+
+    constexpr fmf_33    m1 = LST_33_1;
+    constexpr fmf_33    m2 = []
+    {
+        fmf_33  m = LST_33_1;
+        axpy(2.0f, fmf_33(LST_33_1), m);
+        scale(2, m);
+        return m;
+    }();
+
+    EXPECT_EQ(m2, 6.0f * m1);
+}
+
+TEST(Mul, CompoundAssignment)
+{
+    using cmd = matrix<matrix_storage_engine<double, std::dynamic_extent, std::dynamic_extent,
+                                             std::allocator<double>, matrix_layout::column_major>>;
+
+    dynamic_matrix<double>  a(37, 29);
+    dynamic_matrix<double>  b(29, 29);
+    cmd                     c(37, 29);
+
+    fill_product_operand(a, 1);
+    fill_product_operand(b, 2);
+    fill_product_operand(c, 3);
+
+    //- Products with a square right-hand operand are computed in place, for dense operands,
+    //  views, and operands of mixed layout.
+    //
+    dynamic_matrix<double>  r1 = a;
+    cmd                     r2 = c;
+    dynamic_matrix<double>  r3 = a;
+
+    r1 *= b;
+    r2 *= b.t();
+    r3 *= cmd(b);
+    EXPECT_EQ(r1, a * b);
+    EXPECT_EQ(r2, c * b.t());
+    EXPECT_EQ(r3, a * b);
+
+    dynamic_matrix<double>  r4 = b;
+    r4 *= r4;
+    EXPECT_EQ(r4, b * b);
+
+    dynamic_matrix<double>  r5 = a;
+    r5 *= 2.0;
+    EXPECT_EQ(r5, 2.0 * a);
+
+    auto    r6 = r1.t();
+    r6 *= 0.5;
+    EXPECT_EQ(r1, 0.5 * (a * b));
+
+    //- Integer elements are scaled as they are by the binary operator, and not by a scalar
+    //  first truncated to the element type.
+    //
+    dynamic_matrix<int>     n1(3, 4);
+
+    for (size_t i = 0;  i < n1.rows();  ++i)
+    {
+        for (size_t j = 0;  j < n1.columns();  ++j)
+        {
+            n1(i, j) = static_cast<int>(1 + 2*i + j);
+        }
+    }
+
+    dynamic_matrix<int>     n2 = n1;
+    n2 *= 0.5;
+    EXPECT_EQ(n2, dynamic_matrix<int>(n1 * 0.5));
+    EXPECT_EQ(n2(1, 0), 1);
+
+    dynamic_matrix<int>     n3 = n1;
+    scale(1.5, n3);
+    EXPECT_EQ(n3, dynamic_matrix<int>(1.5 * n1));
+    EXPECT_EQ(n3(1, 0), 4);
+
+    EXPECT_THROW(r1 *= a, runtime_error);
+
+    constexpr fmf_33    m1 = LST_33_1;
+    constexpr fmf_33    m2 = []
+    {
+        fmf_33  m = LST_33_1;
+        m *= fmf_33(LST_33_2);
+        m *= 2;
+        return m;
+    }();
+
+    EXPECT_EQ(m2, 2.0f * (m1 * fmf_33(LST_33_2)));
+}
+
+TEST(Mul, Aliasing)
+{
+    using ldd = dynamic_matrix<double, lazy_matrix_operation_traits>;
+    using mes = matrix_engine_support;
+
+    dynamic_matrix<double>  a(24, 24);
+    dynamic_matrix<double>  b(24, 24);
+
+    fill_product_operand(a, 1);
+    fill_product_operand(b, 2);
+
+    //- Overlap is detected through views and expressions.
+    //
+    auto const  at = a.t();
+    auto const  as = a.submatrix(4, 8, 4, 8);
+
+    EXPECT_TRUE(mes::overlap(a.engine(), a.engine()));
+    EXPECT_FALSE(mes::overlap(a.engine(), b.engine()));
+    EXPECT_TRUE(mes::overlap(a.engine(), at.engine()));
+    EXPECT_TRUE(mes::overlap(a.engine(), as.engine()));
+    EXPECT_FALSE(mes::overlap(as.engine(), a.submatrix(12, 8, 4, 8).engine()));
+    EXPECT_FALSE(mes::overlap(b.engine(), as.engine()));
+
+    EXPECT_FALSE(mes::may_alias(a.engine(), a.t().t().engine()));
+    EXPECT_FALSE(mes::may_alias(a.engine(), (-a).engine()));
+    EXPECT_TRUE(mes::may_alias(a.engine(), at.engine()));
+    EXPECT_TRUE(mes::may_alias(a.engine(), as.engine()));
+
+    //- Assignments and updates through aliased operands give the same results as through
+    //  independent copies.
+    //
+    dynamic_matrix<double>  r1 = a;
+    r1 = r1.t();
+    EXPECT_EQ(r1, a.t());
+
+    dynamic_matrix<double>  r2 = a;
+    r2 += r2.t();
+    EXPECT_EQ(r2, a + a.t());
+
+    dynamic_matrix<double>  r3 = a;
+    r3 -= -r3;
+    EXPECT_EQ(r3, 2.0 * a);
+
+    dynamic_matrix<double>  r4 = a;
+    r4 *= r4.t();
+    EXPECT_EQ(r4, a * a.t());
+
+    dynamic_matrix<double>  r5 = a;
+    gemm(1.0, r5, b, 0.0, r5);
+    EXPECT_EQ(r5, a * b);
+
+    dynamic_matrix<double>  r6 = a;
+    gemm(2.0, b, r6.t(), 1.0, r6);
+    EXPECT_EQ(r6, 2.0 * (b * a.t()) + a);
+
+    dynamic_matrix<double>  r7 = a;
+    axpy(1.0, r7.t(), r7);
+    EXPECT_EQ(r7, a + a.t());
+
+    dynamic_matrix<double>  r8 = a;
+    auto                    sub = r8.submatrix(0, 8, 0, 8);
+    sub = r8.submatrix(2, 8, 3, 8);
+    EXPECT_EQ(sub, a.submatrix(2, 8, 3, 8));
+
+    //- Lazy expressions that refer to the destination.
+    //
+    ldd     la = a;
+    ldd     lb = b;
+
+    la = la + lb;
+    EXPECT_EQ(la, a + b);
+
+    la = la.t() - lb;
+    EXPECT_EQ(la, (a + b).t() - b);
+
+    //- An explicit opt-out writes in place without checking.
+    //
+    dynamic_matrix<double>  r9(24, 24);
+    r9.noalias() = a;
+    r9.noalias() += b;
+    r9.noalias() -= a;
+    EXPECT_EQ(r9, b);
+
+    r9.noalias() *= a;
+    EXPECT_EQ(r9, b * a);
+
+    constexpr fmf_33    m1 = LST_33_1;
+    constexpr fmf_33    m2 = []
+    {
+        fmf_33  m = LST_33_1;
+        m = m.t();
+        m += m.t();
+        m *= m;
+        return m;
+    }();
+
+    EXPECT_EQ(m2, (m1 + m1.t()) * (m1 + m1.t()));
+}
+
+TEST(Mul, Submatrix)
+{
+    using mes = matrix_engine_support;
+    using cmd = matrix<matrix_storage_engine<double, std::dynamic_extent, std::dynamic_extent,
+                                             std::allocator<double>, matrix_layout::column_major>>;
+
+    dynamic_matrix<double>  a(60, 60);
+    dynamic_matrix<double>  b(60, 60);
+    cmd                     c(60, 60);
+
+    fill_product_operand(a, 1);
+    fill_product_operand(b, 2);
+    fill_product_operand(c, 3);
+
+    //- Distinct tiles of one matrix do not overlap, although their address ranges do.
+    //
+    auto const  a11 = a.submatrix(0, 30, 0, 30);
+    auto const  c11 = c.submatrix(0, 30, 0, 30);
+
+    EXPECT_FALSE(mes::overlap(a11.engine(), a.submatrix(0, 30, 30, 30).engine()));
+    EXPECT_FALSE(mes::overlap(a11.engine(), a.submatrix(30, 30, 0, 30).engine()));
+    EXPECT_FALSE(mes::overlap(a.submatrix(30, 30, 30, 30).engine(), a.submatrix(20, 40, 0, 30).engine()));
+    EXPECT_FALSE(mes::overlap(c11.engine(), c.submatrix(30, 30, 0, 60).engine()));
+    EXPECT_FALSE(mes::overlap(c11.engine(), c.submatrix(0, 60, 30, 30).engine()));
+    EXPECT_TRUE(mes::overlap(a11.engine(), a.submatrix(29, 30, 29, 30).engine()));
+    EXPECT_TRUE(mes::overlap(c11.engine(), c.submatrix(29, 30, 29, 30).engine()));
+    EXPECT_TRUE(mes::overlap(a11.engine(), a11.t().engine()));
+    EXPECT_FALSE(mes::may_alias(a11.engine(), a.submatrix(0, 30, 0, 30).engine()));
+
+    //- A trailing update in the manner of a blocked factorization, computed in place from
+    //  tiles of the same matrix.
+    //
+    dynamic_matrix<double>  w = a;
+    auto                    w22 = w.submatrix(20, 40, 20, 40);
+
+    gemm(-1.0, w.submatrix(20, 40, 0, 20), w.submatrix(0, 20, 20, 40), 1.0, w22);
+    EXPECT_EQ(w22, a.submatrix(20, 40, 20, 40) - a.submatrix(20, 40, 0, 20) * a.submatrix(0, 20, 20, 40));
+    EXPECT_EQ(w.submatrix(0, 20, 0, 60), a.submatrix(0, 20, 0, 60));
+    EXPECT_EQ(w.submatrix(20, 40, 0, 20), a.submatrix(20, 40, 0, 20));
+
+    //- Products, sums, and copies of tiles.
+    //
+    check_product(a.submatrix(5, 40, 3, 50), c.submatrix(7, 50, 2, 45),
+                  a.submatrix(5, 40, 3, 50) * c.submatrix(7, 50, 2, 45));
+    check_product(a.submatrix(5, 40, 3, 50).t(), b.submatrix(4, 40, 1, 30),
+                  a.submatrix(5, 40, 3, 50).t() * b.submatrix(4, 40, 1, 30));
+
+    auto    s = a.submatrix(3, 17, 5, 19) + c.submatrix(1, 17, 2, 19);
+
+    for (size_t i = 0;  i < 17;  ++i)
+    {
+        for (size_t j = 0;  j < 19;  ++j)
+        {
+            EXPECT_EQ(s(i, j), a(i + 3, j + 5) + c(i + 1, j + 2));
+        }
+    }
+
+    dynamic_matrix<double>  b0 = b;
+    dynamic_matrix<double>  t  = c.submatrix(10, 20, 15, 25);
+    auto                    bt = b.submatrix(31, 20, 30, 25);
+
+    bt = c.submatrix(10, 20, 15, 25);
+    EXPECT_EQ(t, c.submatrix(10, 20, 15, 25));
+    EXPECT_EQ(bt, t);
+    EXPECT_EQ(b.submatrix(0, 31, 0, 60), b0.submatrix(0, 31, 0, 60));
+    EXPECT_EQ(b.submatrix(31, 20, 0, 30), b0.submatrix(31, 20, 0, 30));
+}
+
+TEST(Mul, Chain)
+{
+    //- Classic example: (A*B)*C costs 7500 multiplications, A*(B*C) costs 75000.
+    //
+    constexpr auto  s1 = matrix_chain_support::plan<3>({10, 100, 5, 50});
+    EXPECT_EQ(s1[0][2], 1u);
+    EXPECT_EQ(s1[0][1], 0u);
+
+    constexpr auto  s2 = matrix_chain_support::plan<4>({40, 40, 40, 40, 1});
+    EXPECT_EQ(s2[0][3], 0u);
+    EXPECT_EQ(s2[1][3], 1u);
+
+    //- Dynamically-sized operands.
+    //
+    dynamic_matrix<double>  a(30, 40);
+    dynamic_matrix<double>  b(40, 20);
+    dynamic_matrix<double>  c(20, 35);
+    dynamic_matrix<double>  x(35, 1);
+
+    fill_product_operand(a, 1);
+    fill_product_operand(b, 2);
+    fill_product_operand(c, 3);
+    fill_product_operand(x, 4);
+
+    auto    r1 = multiply_chain(a, b, c, x);
+    EXPECT_TRUE((is_same_v<decltype(r1), dynamic_matrix<double>>));
+    EXPECT_EQ(r1, a * b * c * x);
+
+    auto    r2 = multiply_chain(a, b);
+    EXPECT_EQ(r2, a * b);
+
+    auto    r3 = multiply_chain(c.t(), b.t(), a.t(), a, b);
+    EXPECT_EQ(r3, c.t() * b.t() * a.t() * a * b);
+
+    EXPECT_THROW(multiply_chain(a, b, a, x), runtime_error);
+
+    //- Mixed fixed-size and dynamically-sized operands.
+    //
+    fixed_size_matrix<double, 20, 35>   cf;
+    fill_product_operand(cf, 3);
+
+    auto    r4 = multiply_chain(a, b, cf, x);
+    EXPECT_EQ(r4, r1);
+
+    //- Fixed-size operands; the order is chosen at compile time.
+    //
+    constexpr fmf_34    m1 = LST_34_1;
+    constexpr fmf_43    m2 = LST_34_1_T;
+    constexpr fmf_33    m3 = LST_33_1;
+    constexpr auto      r5 = multiply_chain(m1, m2, m3, m1);
+
+    EXPECT_TRUE((is_same_v<decltype(r5), fmf_34 const>));
+    EXPECT_EQ(r5, m1 * m2 * m3 * m1);
+}
@@ -0,0 +1,156 @@
+#define ENABLE_TEST_PRINTING
+#include "test_common.hpp"
+
+using namespace STD_LA;
+using namespace STD_LA::detail;
+using namespace MDSPAN_NS;
+
+using fmd_33 = fixed_size_matrix<double, 3, 3>;
+using fmd_32 = fixed_size_matrix<double, 3, 2>;
+using dmd    = dynamic_matrix<double>;
+
+using bf8    = batch_element<float, 8>;
+using fbf_33 = fixed_size_matrix<bf8, 3, 3>;
+using fbf_31 = fixed_size_matrix<bf8, 3, 1>;
+
+template<class MT1, class MT2>
+void
+expect_near(MT1 const& m1, MT2 const& m2, double tol)
+{
+    ASSERT_EQ(m1.rows(), m2.rows());
+    ASSERT_EQ(m1.columns(), m2.columns());
+
+    for (ptrdiff_t i = 0;  i < (ptrdiff_t) m1.rows();  ++i)
+    {
+        for (ptrdiff_t j = 0;  j < (ptrdiff_t) m1.columns();  ++j)
+        {
+            EXPECT_NEAR(m1(i, j), m2(i, j), tol);
+        }
+    }
+}
+
+TEST(Solve, Constexpr)
+{
+    //- The first pivot is zero, so that rows must be exchanged; all of the arithmetic is exact.
+    //
+    constexpr fmd_33    a  = {{0, 2, 0}, {1, 0, 0}, {0, 1, 4}};
+    constexpr fmd_32    x  = {{1, 1}, {2, 1}, {1, 1}};
+    constexpr fmd_32    b  = a * x;
+    constexpr fmd_32    x2 = solve(a, b);
+    constexpr fmd_33    ai = inverse(a);
+
+    static_assert(x2 == x);
+    static_assert(a * ai == fmd_33{{1, 0, 0}, {0, 1, 0}, {0, 0, 1}});
+    EXPECT_EQ(x2, x);
+}
+
+TEST(Solve, Dynamic)
+{
+    size_t const    n = 40;
+
+    dmd     a(n, n);
+    dmd     x(n, 3);
+
+    for (ptrdiff_t i = 0;  i < (ptrdiff_t) n;  ++i)
+    {
+        for (ptrdiff_t j = 0;  j < (ptrdiff_t) n;  ++j)
+        {
+            a(i, j) = ((i*7 + j*3) % 11) - 5 + ((i == j) ? 20 : 0);
+        }
+        for (ptrdiff_t j = 0;  j < 3;  ++j)
+        {
+            x(i, j) = ((i + j) % 5) - 2;
+        }
+    }
+
+    dmd     b  = a * x;
+    auto    x2 = solve(a, b);
+    auto    ai = inverse(a);
+
+    EXPECT_TRUE((is_same_v<decltype(x2), dmd>));
+    expect_near(x2, x, 1e-10);
+    expect_near(inverse(ai), a, 1e-10);
+
+    dmd     id = a * ai;
+
+    for (ptrdiff_t i = 0;  i < (ptrdiff_t) n;  ++i)
+    {
+        for (ptrdiff_t j = 0;  j < (ptrdiff_t) n;  ++j)
+        {
+            EXPECT_NEAR(id(i, j), (i == j) ? 1.0 : 0.0, 1e-12);
+        }
+    }
+
+    //- Views and complex elements.
+    //
+    using cd = std::complex<double>;
+
+    dynamic_matrix<cd>  c(3, 3);
+    dynamic_matrix<cd>  y(3, 1);
+
+    c(0, 0) = cd(0, 1);  c(0, 1) = cd(2, 0);  c(0, 2) = cd(1, -1);
+    c(1, 0) = cd(1, 0);  c(1, 1) = cd(0, 0);  c(1, 2) = cd(3, 1);
+    c(2, 0) = cd(2, 2);  c(2, 1) = cd(1, 0);  c(2, 2) = cd(0, 0);
+    y(0, 0) = cd(1, 0);  y(1, 0) = cd(0, 1);  y(2, 0) = cd(-1, 2);
+
+    auto    y2 = solve(c.t(), c.t() * y);
+
+    for (ptrdiff_t i = 0;  i < 3;  ++i)
+    {
+        EXPECT_NEAR(std::abs(y2(i, 0) - y(i, 0)), 0.0, 1e-12);
+    }
+
+    //- Errors.
+    //
+    dmd     s(3, 3);
+
+    EXPECT_THROW(solve(x, x), runtime_error);
+    EXPECT_THROW(solve(a, dmd(3, 1)), runtime_error);
+    EXPECT_THROW(inverse(x), runtime_error);
+    EXPECT_THROW(inverse(s), runtime_error);
+}
+
+TEST(Solve, Batch)
+{
+    //- Each lane holds a different system; the lanes differ in which rows must be exchanged.
+    //
+    fbf_33  a;
+    fbf_31  x;
+
+    for (size_t p = 0;  p < bf8::size();  ++p)
+    {
+        float const     f = static_cast<float>(p);
+
+        a(0, 0)[p] = f - 3;  a(0, 1)[p] = 2;      a(0, 2)[p] = 1;
+        a(1, 0)[p] = 1;      a(1, 1)[p] = 5 - f;  a(1, 2)[p] = 1;
+        a(2, 0)[p] = 2;      a(2, 1)[p] = 1;      a(2, 2)[p] = f;
+
+        for (ptrdiff_t i = 0;  i < 3;  ++i)
+        {
+            x(i, 0)[p] = static_cast<float>(i) + f;
+        }
+    }
+
+    fbf_31  b  = a * x;
+    fbf_31  x2 = solve(a, b);
+    fbf_33  ai = inverse(a);
+    fbf_33  id = a * ai;
+
+    for (size_t p = 0;  p < bf8::size();  ++p)
+    {
+        for (ptrdiff_t i = 0;  i < 3;  ++i)
+        {
+            EXPECT_NEAR(x2(i, 0)[p], x(i, 0)[p], 1e-4f);
+
+            for (ptrdiff_t j = 0;  j < 3;  ++j)
+            {
+                EXPECT_NEAR(id(i, j)[p], (i == j) ? 1.0f : 0.0f, 1e-5f);
+            }
+        }
+    }
+
+    //- One singular lane makes the batch singular.
+    //
+    a(0, 0)[5] = 0.0f;  a(0, 1)[5] = 0.0f;  a(0, 2)[5] = 0.0f;
+    EXPECT_THROW(inverse(a), runtime_error);
+}
@@ -88,3 +88,93 @@ TEST(Sub, Constexpr)
     PRINT(xc7);
     PRINT(xc8);
 }
+
+TEST(Sub, OperandViews)
+{
+    using cmd = matrix<matrix_storage_engine<double, std::dynamic_extent, std::dynamic_extent,
+                                             std::allocator<double>, matrix_layout::column_major>>;
+
+    dynamic_matrix<double>  a(13, 17), b(17, 13);
+    cmd                     c(13, 17);
+
+    for (size_t i = 0;  i < a.rows();  ++i)
+    {
+        for (size_t j = 0;  j < a.columns();  ++j)
+        {
+            a(i, j) = 1.0 + i + 2*j;
+            b(j, i) = 0.5 * i - j;
+            c(i, j) = 3.0 * i - 0.25 * j;
+        }
+    }
+
+    //- Transpose and negation views of dense engines are read through their spans, and the
+    //  results must match those computed element by element.
+    //
+    auto    check = [](auto const& m1, auto const& m2, auto const& r)
+    {
+        ASSERT_EQ(r.rows(), m1.rows());
+        ASSERT_EQ(r.columns(), m1.columns());
+
+        for (size_t i = 0;  i < r.rows();  ++i)
+        {
+            for (size_t j = 0;  j < r.columns();  ++j)
+            {
+                EXPECT_EQ(r(i, j), m1(i, j) - m2(i, j));
+            }
+        }
+    };
+
+    check(a, b.t(), a - b.t());
+    check(-a, b.t(), -a - b.t());
+    check(a, -b.t(), a - -b.t());
+    check(-a, -b.t(), -a - -b.t());
+    check(b.t(), -(-a), b.t() - -(-a));
+    check(-b, a.t(), -b - a.t());
+    check(a, c, a - c);
+    check(-c, b.t(), -c - b.t());
+
+    auto    r = a;
+
+    r -= -b.t();
+    check(a, -b.t(), r);
+}
+
+TEST(Sub, CompoundAssignment)
+{
+    dynamic_matrix<double>  a(13, 17), b(13, 17);
+
+    for (size_t i = 0;  i < a.rows();  ++i)
+    {
+        for (size_t j = 0;  j < a.columns();  ++j)
+        {
+            a(i, j) = 1.0 + i + 2*j;
+            b(i, j) = 0.5 * i - j;
+        }
+    }
+
+    auto    r1 = a;
+    auto    r2 = a;
+    auto    r3 = a.t();
+
+    r1 -= b;
+    r2 -= b.t().t();
+    EXPECT_EQ(r1, a - b);
+    EXPECT_EQ(r2, a - b);
+
+    r3 -= b.t();
+    EXPECT_EQ(a, r1);
+
+    dynamic_matrix<double>  w(13, 16);
+    EXPECT_THROW(r1 -= w, runtime_error);
+
+    constexpr fmf_33    m1 = LST_33_1;
+    constexpr fmf_33    m2 = LST_33_2;
+    constexpr fmf_33    m3 = []
+    {
+        fmf_33  m = LST_33_1;
+        m -= fmf_33(LST_33_2);
+        return m;
+    }();
+
+    EXPECT_EQ(m3, m1 - m2);
+}
@@ -0,0 +1,852 @@
+#define ENABLE_TEST_PRINTING
+#include "test_common.hpp"
+
+using namespace STD_LA;
+using namespace STD_LA::detail;
+using namespace MDSPAN_NS;
+
+using dmd    = dynamic_matrix<double>;
+using dmf    = dynamic_matrix<float>;
+using dcvd   = dynamic_column_vector<double>;
+using fcvd_3 = fixed_size_column_vector<double, 3>;
+using smd    = sparse_matrix<double>;
+using smd_32 = sparse_matrix<double, uint32_t>;
+using cmd    = matrix<matrix_storage_engine<double, dynamic_extent, dynamic_extent,
+                                            std::allocator<double>, matrix_layout::column_major>>;
+using scd    = matrix<sparse_matrix_engine<double, size_t, std::allocator<double>,
+                                           matrix_layout::column_major>>;
+using scd_32 = matrix<sparse_matrix_engine<double, uint32_t, std::allocator<double>,
+                                           matrix_layout::column_major>>;
+using sld    = sliced_ellpack_matrix<double>;
+using sld_32 = sliced_ellpack_matrix<double, uint32_t>;
+
+template<class MT>
+void
+fill_sparse_operand(MT& m, int seed)
+{
+    for (ptrdiff_t i = 0;  i < (ptrdiff_t) m.rows();  ++i)
+    {
+        for (ptrdiff_t j = 0;  j < (ptrdiff_t) m.columns();  ++j)
+        {
+            using elem_type = typename MT::element_type;
+
+            bool const  nz = ((i*7 + j*3 + seed) % 13) < 2  ||  i == j;
+
+            m(i, j) = (nz) ? static_cast<elem_type>((i*5 + j + seed) % 9 - 4) : elem_type{};
+        }
+    }
+}
+
+template<class MT>
+void
+fill_dense_operand(MT& m, int seed)
+{
+    for (ptrdiff_t i = 0;  i < (ptrdiff_t) m.rows();  ++i)
+    {
+        for (ptrdiff_t j = 0;  j < (ptrdiff_t) m.columns();  ++j)
+        {
+            using elem_type = typename MT::element_type;
+
+            m(i, j) = static_cast<elem_type>((i*7 + j*3 + seed) % 11 - 5);
+        }
+    }
+}
+
+TEST(Sparse, Construct)
+{
+    //- From the compressed arrays; element (1, 1) is not stored, and reads as zero.
+    //
+    smd     s1(sparse_matrix_engine<double>(3, 4, {0, 2, 3, 5}, {0, 3, 2, 1, 3}, {1, 2, 3, 4, 5}));
+    dmd     d1 = {{1, 0, 0, 2}, {0, 0, 3, 0}, {0, 4, 0, 5}};
+
+    PRINT(s1);
+    EXPECT_EQ(s1.rows(), 3);
+    EXPECT_EQ(s1.columns(), 4);
+    EXPECT_EQ(s1.size(), 12);
+    EXPECT_EQ(s1.engine().nonzeros(), 5);
+    EXPECT_EQ(s1(0, 3), 2.0);
+    EXPECT_EQ(s1(1, 1), 0.0);
+    EXPECT_EQ(s1, d1);
+
+    //- By compressing a dense matrix, and back again.
+    //
+    smd_32  s2(d1);
+    dmd     d2(s2);
+
+    EXPECT_EQ(s2.engine().nonzeros(), 5);
+    EXPECT_EQ(s2, s1);
+    EXPECT_EQ(d2, d1);
+    EXPECT_EQ(s2.t()(3, 2), 5.0);
+
+    std::vector<uint32_t> const     offsets(s2.engine().row_offsets().begin(), s2.engine().row_offsets().end());
+    std::vector<uint32_t> const     indices(s2.engine().column_indices().begin(), s2.engine().column_indices().end());
+
+    EXPECT_EQ(offsets, (std::vector<uint32_t>{0, 2, 3, 5}));
+    EXPECT_EQ(indices, (std::vector<uint32_t>{0, 3, 2, 1, 3}));
+
+    //- An empty matrix of the given extents.
+    //
+    smd     s3(sparse_matrix_engine<double>(5, 6));
+
+    EXPECT_EQ(s3.rows(), 5);
+    EXPECT_EQ(s3.columns(), 6);
+    EXPECT_EQ(s3.engine().nonzeros(), 0);
+    EXPECT_EQ(s3(4, 5), 0.0);
+
+    //- Invalid structures are rejected.
+    //
+    using sme = sparse_matrix_engine<double>;
+
+    EXPECT_THROW(sme(3, 4, {0, 2, 3}, {0, 3, 2}, {1, 2, 3}), runtime_error);
+    EXPECT_THROW(sme(3, 4, {0, 2, 3, 5}, {0, 3, 2, 1, 4}, {1, 2, 3, 4, 5}), runtime_error);
+    EXPECT_THROW(sme(3, 4, {0, 2, 3, 5}, {3, 0, 2, 1, 3}, {1, 2, 3, 4, 5}), runtime_error);
+    EXPECT_THROW(sme(3, 4, {0, 2, 3, 5}, {0, 3, 2, 1, 3}, {1, 2, 3, 4}), runtime_error);
+    EXPECT_THROW(sme(3, 4, {0, 3, 2, 5}, {0, 3, 2, 1, 3}, {1, 2, 3, 4, 5}), runtime_error);
+    EXPECT_THROW(sme(3, 4, {0, 10, 5, 5}, {0, 3, 2, 1, 3}, {1, 2, 3, 4, 5}), runtime_error);
+    EXPECT_THROW((sparse_matrix_engine<double, uint8_t>(2, 300)), runtime_error);
+}
+
+TEST(Sparse, Constexpr)
+{
+    constexpr double    r = []
+    {
+        fcvd_3  x = {1, 2, 3};
+        smd     a(sparse_matrix_engine<double>(3, 3, {0, 1, 3, 4}, {2, 0, 1, 2}, {4, 1, 2, 3}));
+        auto    y = a * x;
+
+        return y(0, 0) + 10*y(1, 0) + 100*y(2, 0);
+    }();
+
+    EXPECT_EQ(r, 12.0 + 50.0 + 900.0);
+}
+
+TEST(Sparse, SpMV)
+{
+    dmd     d(300, 250);
+    dcvd    x(250);
+    dmd     xr(250, 1);
+
+    fill_sparse_operand(d, 1);
+    fill_dense_operand(x, 2);
+    fill_dense_operand(xr, 2);
+
+    dmd     xt = x.t();
+    smd     s(d);
+    smd_32  s32(d);
+
+    EXPECT_LT(s.engine().nonzeros(), d.size() / 4);
+
+    //- The elements are small integers, so the products are exact in any order.
+    //
+    auto    y1 = s * x;
+    auto    y2 = s32 * x;
+    auto    y3 = s * xr;
+    auto    y4 = s * xt.t();
+
+    PRINT_TYPE(decltype(y1));
+    EXPECT_EQ(y1, d * x);
+    EXPECT_EQ(y2, d * x);
+    EXPECT_EQ(y3, d * xr);
+    EXPECT_EQ(y4, d * x);
+
+    //- Single-precision elements, and a column of a dense matrix.
+    //
+    dmf     df(40, 30);
+    dmf     bf(30, 5);
+
+    fill_sparse_operand(df, 3);
+    fill_dense_operand(bf, 4);
+
+    sparse_matrix<float>    sf(df);
+
+    EXPECT_EQ(sf * bf.column(2), df * bf.column(2));
+
+    //- Mis-matched extents are an error.
+    //
+    EXPECT_THROW(s * dcvd(249), runtime_error);
+}
+
+TEST(Sparse, SpMM)
+{
+    dmd     d(200, 150);
+    dmd     b(150, 70);
+    cmd     bc(150, 70);
+
+    fill_sparse_operand(d, 5);
+    fill_dense_operand(b, 6);
+    fill_dense_operand(bc, 6);
+
+    smd     s(d);
+    dmd     r = d * b;
+
+    //- Row-major, column-major, and transposed dense operands, and a submatrix.
+    //
+    EXPECT_EQ(s * b, r);
+    EXPECT_EQ(s * bc, r);
+    EXPECT_EQ(s * b.t().t(), r);
+    EXPECT_EQ(s * b.submatrix(0, 150, 10, 20), r.submatrix(0, 200, 10, 20));
+
+    dmd     bt = b.t();
+
+    EXPECT_EQ(s * bt.t(), r);
+
+    //- Operands that the kernel does not accept are computed by the loops.
+    //
+    EXPECT_EQ(s * (-b), -r);
+    EXPECT_EQ(s * (b + b), r + r);
+    EXPECT_EQ(s * s.t(), d * d.t());
+
+    //- An empty sparse matrix, and one having empty rows.
+    //
+    smd     z(sparse_matrix_engine<double>(200, 150));
+    dmd     zd(200, 70);
+
+    EXPECT_EQ(z * b, zd);
+
+    dmd     e(4, 3);
+
+    e(1, 2) = 2.0;
+    e(3, 0) = -1.0;
+    EXPECT_EQ(smd(e) * b.submatrix(0, 3, 0, 70), e * b.submatrix(0, 3, 0, 70));
+}
+
+TEST(Sparse, CSC)
+{
+    //- From the compressed arrays of the columns, and by compressing a dense matrix.
+    //
+    using sce = sparse_matrix_engine<double, size_t, std::allocator<double>, matrix_layout::column_major>;
+
+    scd     s1(sce(3, 4, {0, 1, 2, 3, 5}, {0, 2, 1, 0, 2}, {1, 4, 3, 2, 5}));
+    dmd     d1 = {{1, 0, 0, 2}, {0, 0, 3, 0}, {0, 4, 0, 5}};
+    scd_32  s2(d1);
+
+    PRINT(s1);
+    EXPECT_EQ(s1.engine().nonzeros(), 5);
+    EXPECT_EQ(s1, d1);
+    EXPECT_EQ(s2, d1);
+    EXPECT_EQ(s1(2, 1), 4.0);
+    EXPECT_EQ(s1(1, 1), 0.0);
+
+    std::vector<uint32_t> const     offsets(s2.engine().column_offsets().begin(), s2.engine().column_offsets().end());
+    std::vector<uint32_t> const     indices(s2.engine().row_indices().begin(), s2.engine().row_indices().end());
+
+    EXPECT_EQ(offsets, (std::vector<uint32_t>{0, 1, 2, 3, 5}));
+    EXPECT_EQ(indices, (std::vector<uint32_t>{0, 2, 1, 0, 2}));
+    EXPECT_THROW(sce(3, 4, {0, 2, 3, 5}, {0, 3, 2, 1, 3}, {1, 2, 3, 4, 5}), runtime_error);
+
+    //- Products with vectors and with matrices of both layouts.
+    //
+    dmd     d(180, 140);
+    dcvd    x(140);
+    dmd     b(140, 30);
+    cmd     bc(140, 30);
+
+    fill_sparse_operand(d, 7);
+    fill_dense_operand(x, 8);
+    fill_dense_operand(b, 9);
+    fill_dense_operand(bc, 9);
+
+    scd     s(d);
+    dmd     r = d * b;
+
+    EXPECT_EQ(s * x, d * x);
+    EXPECT_EQ(s * b, r);
+    EXPECT_EQ(s * bc, r);
+    EXPECT_EQ(s * b.column(3), d * b.column(3));
+    EXPECT_EQ(s * (b + b), r + r);
+    EXPECT_THROW(s * dcvd(139), runtime_error);
+}
+
+TEST(Sparse, Assembly)
+{
+    //- Many threads insert duplicated elements, each into its own buffer, at 16 distinct positions
+    //  in each row.  The values are small integers, so the sums are exact in any order.
+    //
+    size_t const    rows    = 300;
+    size_t const    cols    = 200;
+    size_t const    threads = 4;
+    size_t const    count   = 150000;
+
+    sparse_matrix_builder<double>   builder(rows, cols, threads);
+    std::vector<std::thread>        workers;
+    dmd                             d(rows, cols);
+
+    for (size_t t = 0;  t < threads;  ++t)
+    {
+        workers.emplace_back([&builder, t]
+        {
+            auto&   buf = builder.buffer(t);
+
+            buf.reserve(count);
+
+            for (size_t k = 0;  k < count;  ++k)
+            {
+                size_t const    p = (k * 7919 + t * 104729) % (rows * 16);
+
+                buf.insert(p % rows, (p / rows * 13) % cols, static_cast<double>((k + t) % 5) - 2.0);
+            }
+        });
+    }
+    for (auto& w : workers)
+    {
+        w.join();
+    }
+    for (size_t t = 0;  t < threads;  ++t)
+    {
+        for (size_t k = 0;  k < count;  ++k)
+        {
+            size_t const    p = (k * 7919 + t * 104729) % (rows * 16);
+
+            d(p % rows, (p / rows * 13) % cols) += static_cast<double>((k + t) % 5) - 2.0;
+        }
+    }
+
+    EXPECT_EQ(builder.size(), threads * count);
+
+    //- Compress to both forms, the first by many threads; this empties the builder.
+    //
+    sparse_matrix_builder<double>   builder2(rows, cols, 1);
+
+    for (size_t t = 0;  t < threads;  ++t)
+    {
+        for (size_t k = 0;  k < count;  ++k)
+        {
+            size_t const    p = (k * 7919 + t * 104729) % (rows * 16);
+
+            builder2.insert(p % rows, (p / rows * 13) % cols, static_cast<double>((k + t) % 5) - 2.0);
+        }
+    }
+
+    smd     s1(builder.compress(threads));
+    scd_32  s2(sparse_matrix_builder<double, uint32_t>(rows, cols, 1).compress<matrix_layout::column_major>());
+
+    EXPECT_EQ(builder.size(), 0);
+    EXPECT_EQ(s1, d);
+    EXPECT_EQ(s1.engine().nonzeros(), rows * 16);
+    EXPECT_EQ(s2.engine().nonzeros(), 0);
+
+    scd     s3(builder2.compress<matrix_layout::column_major>(1));
+
+    EXPECT_EQ(s3, d);
+    EXPECT_EQ(s3.engine().nonzeros(), rows * 16);
+
+    //- Out-of-range positions, and extents that cannot be indexed, are errors.
+    //
+    EXPECT_THROW(builder.insert(rows, 0, 1.0), runtime_error);
+    EXPECT_THROW(builder.buffer(1).insert(0, cols, 1.0), runtime_error);
+    EXPECT_THROW((sparse_matrix_builder<double, uint8_t>(300, 2)), runtime_error);
+}
+
+TEST(Sparse, Dictionary)
+{
+    using builder_type = sparse_matrix_builder<double, size_t, std::allocator<double>,
+                                               sparse_assembly::dictionary>;
+
+    builder_type    builder(4, 5, 2);
+    dmd             d = {{3, 0, 0, 0, 0}, {0, 0, -1, 0, 0}, {0, 0, 0, 0, 0}, {0, 4, 0, 0, 0}};
+
+    builder.insert(0, 0, 1.0);
+    builder.insert(1, 2, 2.0);
+    builder.insert(0, 0, 2.0);
+    builder.insert(3, 4, 1.0);
+    builder.buffer(1).insert(1, 2, -3.0);
+    builder.buffer(1).insert(3, 1, 4.0);
+    builder.buffer(1).insert(3, 4, -1.0);
+
+    //- Each buffer holds each position once.
+    //
+    EXPECT_EQ(builder.buffer(0).size(), 3);
+    EXPECT_EQ(builder.buffer(1).size(), 3);
+
+    builder_type    builder2 = builder;
+
+    smd     s1(builder.compress());
+    scd     s2(builder2.compress<matrix_layout::column_major>());
+
+    //- Element (3, 4) sums to zero, but remains stored.
+    //
+    EXPECT_EQ(s1, d);
+    EXPECT_EQ(s2, d);
+    EXPECT_EQ(s1.engine().nonzeros(), 4);
+    EXPECT_EQ(s2.engine().nonzeros(), 4);
+}
+
+TEST(Sparse, Pattern)
+{
+    //- The pattern is computed once; each step then recomputes only the values, in place.
+    //
+    size_t const    rows    = 120;
+    size_t const    cols    = 90;
+    size_t const    threads = 3;
+    size_t const    count   = 4000;
+
+    sparse_matrix_builder<double>   builder(rows, cols, threads);
+    sparse_scatter_map              map;
+
+    auto    assemble = [&](int step, dmd& d)
+    {
+        d = dmd(rows, cols);
+
+        for (size_t t = 0;  t < threads;  ++t)
+        {
+            for (size_t k = 0;  k < count;  ++k)
+            {
+                size_t const    p = (k * 7919 + t * 104729) % (rows * 8);
+                double const    v = static_cast<double>((k + t + step) % 7) - 3.0;
+
+                builder.buffer(t).insert(p % rows, (p / rows * 11) % cols, v);
+                d(p % rows, (p / rows * 11) % cols) += v;
+            }
+        }
+    };
+
+    dmd     d;
+
+    assemble(0, d);
+
+    smd     s(builder.compress(map, threads));
+
+    EXPECT_EQ(s, d);
+    EXPECT_EQ(map.size(), threads * count);
+    EXPECT_EQ(map.nonzeros(), s.engine().nonzeros());
+
+    double const* const     pv = s.engine().values().data();
+
+    for (int step = 1;  step < 4;  ++step)
+    {
+        assemble(step, d);
+        builder.compress_values(map, s.engine(), threads);
+
+        EXPECT_EQ(s, d);
+        EXPECT_EQ(s.engine().values().data(), pv);
+        EXPECT_EQ(builder.size(), 0);
+    }
+
+    //- The same, in compressed sparse column form.
+    //
+    sparse_scatter_map  map_c;
+
+    assemble(0, d);
+
+    scd     sc(builder.compress<matrix_layout::column_major>(map_c));
+
+    assemble(5, d);
+    builder.compress_values(map_c, sc.engine());
+    EXPECT_EQ(sc, d);
+
+    //- An assembly having a different number of elements, or an engine having a different
+    //  layout, does not match the pattern.
+    //
+    assemble(6, d);
+    builder.insert(0, 0, 1.0);
+    EXPECT_THROW(builder.compress_values(map, s.engine()), runtime_error);
+
+    builder.clear();
+    assemble(6, d);
+    EXPECT_THROW(builder.compress_values(map_c, s.engine()), runtime_error);
+
+    //- A builder having one buffer sums its elements in place.
+    //
+    sparse_matrix_builder<double>   single(3, 3, 1);
+    sparse_scatter_map              map_1;
+
+    single.insert(2, 1, 1.0);
+    single.insert(0, 0, 2.0);
+    single.insert(2, 1, 3.0);
+
+    smd     s1(single.compress(map_1));
+
+    single.insert(2, 1, -1.0);
+    single.insert(0, 0, 5.0);
+    single.insert(2, 1, 4.0);
+    single.compress_values(map_1, s1.engine());
+
+    EXPECT_EQ(s1, (dmd{{5, 0, 0}, {0, 0, 0}, {0, 3, 0}}));
+    EXPECT_EQ(map_1.nonzeros(), 2u);
+}
+
+TEST(Sparse, SpGEMM)
+{
+    //- Products of two sparse matrices are sparse, in the form of the first operand.  This one
+    //  is large enough to be computed by more than one thread.
+    //
+    dmd     da(400, 300);
+    dmd     db(300, 250);
+
+    fill_sparse_operand(da, 1);
+    fill_sparse_operand(db, 2);
+
+    smd     sa(da);
+    smd_32  sb(db);
+    scd     ca(da);
+    scd_32  cb(db);
+    dmd     r = da * db;
+
+    auto    p1 = sa * sb;
+
+    PRINT_TYPE(decltype(p1));
+    static_assert(is_same_v<decltype(p1), smd>);
+    static_assert(is_same_v<decltype(ca * cb), scd>);
+    EXPECT_EQ(p1, r);
+    EXPECT_LT(p1.engine().nonzeros(), r.size());
+    EXPECT_EQ(ca * cb, r);
+    EXPECT_EQ(sa * cb, r);
+    EXPECT_EQ(ca * sb, r);
+    EXPECT_THROW(sa * sa, runtime_error);
+
+    //- A CSC operand's index type need only represent its number of rows, and so the transpose
+    //  formed for a mixed product must not use it for the column indices of the result.
+    //
+    using csr_ll  = matrix<sparse_matrix_engine<double, long long>>;
+    using csc_16  = matrix<sparse_matrix_engine<double, short, std::allocator<double>,
+                                                matrix_layout::column_major>>;
+    using ll_vec  = std::vector<long long>;
+    using i16_vec = std::vector<short>;
+
+    i16_vec     nb_offsets(40001, 0);
+
+    for (size_t j = 0;  j < 40000;  ++j)
+    {
+        nb_offsets[j + 1] = static_cast<short>(nb_offsets[j] + ((j == 7  ||  j == 39999) ? 1 : 0));
+    }
+
+    csr_ll  na(sparse_matrix_engine<double, long long>(2, 3, ll_vec{0, 2, 3}, ll_vec{0, 2, 1},
+                                                       std::vector<double>{1, 2, 3}));
+    csc_16  nb(typename csc_16::engine_type(3, 40000, nb_offsets, i16_vec{0, 2},
+                                            std::vector<double>{4, 5}));
+    auto    np = na * nb;
+
+    static_assert(is_same_v<decltype(np), csr_ll>);
+    EXPECT_EQ(np.engine().nonzeros(), 2u);
+    EXPECT_EQ(np(0, 7), 4.0);
+    EXPECT_EQ(np(0, 39999), 10.0);
+    EXPECT_EQ(np(1, 39999), 0.0);
+
+    //- A product whose elements are all zero, since the columns of the first operand that hold
+    //  elements select only empty rows of the second.
+    //
+    smd     za(sparse_matrix_engine<double>(3, 4, {0, 1, 2, 2}, {0, 1}, {1, 2}));
+    smd     zb(sparse_matrix_engine<double>(4, 5, {0, 0, 0, 1, 2}, {4, 0}, {3, 4}));
+    auto    zp = za * zb;
+
+    EXPECT_EQ(zp.rows(), 3);
+    EXPECT_EQ(zp.columns(), 5);
+    EXPECT_EQ(zp.engine().nonzeros(), 0u);
+    EXPECT_EQ(zp, dmd(3, 5));
+    EXPECT_EQ(za * smd(sparse_matrix_engine<double>(4, 5)), dmd(3, 5));
+
+    //- Wide operands, whose rows mostly use the hashed accumulator, except for every 50th row of
+    //  the first operand, which is dense enough to use the dense one.
+    //
+    sparse_matrix_builder<double>   ba(600, 3000, 1);
+    sparse_matrix_builder<double>   bb(3000, 800, 1);
+
+    for (size_t i = 0;  i < 600;  ++i)
+    {
+        size_t const    n = (i % 50 == 0) ? 600 : 4;
+
+        for (size_t k = 0;  k < n;  ++k)
+        {
+            ba.insert(i, (i * 37 + k * 1009) % 3000, static_cast<double>((i + k) % 5) - 2.0);
+        }
+    }
+    for (size_t i = 0;  i < 3000;  ++i)
+    {
+        for (size_t k = 0;  k < 4;  ++k)
+        {
+            bb.insert(i, (i * 13 + k * 211) % 800, static_cast<double>((i + 2*k) % 7) - 3.0);
+        }
+    }
+
+    smd     wa(ba.compress());
+    smd     wb(bb.compress());
+
+    EXPECT_EQ(wa * wb, wa * dmd(wb));
+
+    //- A Galerkin triple product, R*A*P, where R is the transpose of the prolongation P.
+    //
+    dmd     dp(300, 60);
+
+    for (size_t i = 0;  i < 300;  ++i)
+    {
+        dp(i, i / 5) = 2.0;
+        dp(i, (i / 5 + 1) % 60) = 1.0;
+    }
+
+    dmd     dsa(300, 300);
+
+    fill_sparse_operand(dsa, 3);
+
+    smd     sp(dp);
+    smd     sr(dp.t());
+    smd     sas(dsa);
+    auto    coarse = sr * sas * sp;
+
+    static_assert(is_same_v<decltype(coarse), smd>);
+    EXPECT_EQ(coarse, dp.t() * dsa * dp);
+
+    //- The triple product again, after the values of A change, recomputing only the values of
+    //  the products recorded with the same patterns.
+    //
+    sparse_product_pattern  pra;
+    sparse_product_pattern  prap;
+
+    auto            ra  = spgemm(pra, sr, sas);
+    auto            rap = spgemm(prap, ra, sp);
+    double const*   pv  = rap.engine().values().data();
+
+    EXPECT_EQ(rap, coarse);
+    EXPECT_EQ(prap.nonzeros(), rap.engine().nonzeros());
+
+    for (auto& v : sas.engine().values())
+    {
+        v = 3.0*v - 1.0;
+    }
+    spgemm_values(pra, sr, sas, ra);
+    spgemm_values(prap, ra, sp, rap);
+
+    EXPECT_EQ(rap, sr * sas * sp);
+    EXPECT_EQ(rap.engine().values().data(), pv);
+    EXPECT_THROW(spgemm_values(pra, sas, sas, ra), runtime_error);
+
+    //- Operands in different forms, whose converted second operand is held by the pattern.
+    //
+    sparse_product_pattern  pm;
+    auto                    mp = spgemm(pm, ca, sb);
+
+    EXPECT_EQ(mp, r);
+    spgemm_values(pm, ca, sb, mp);
+    EXPECT_EQ(mp, r);
+
+    //- Operands of the same extents and numbers of elements, but whose product has a term that
+    //  falls outside the recorded pattern.
+    //
+    sparse_product_pattern  pz;
+    smd                     zs = spgemm(pz, za, zb);
+    smd                     zc(sparse_matrix_engine<double>(3, 4, {0, 1, 2, 2}, {2, 3}, {1, 2}));
+
+    EXPECT_THROW(spgemm_values(pz, zc, zb, zs), runtime_error);
+}
+
+TEST(Sparse, ParallelSpMV)
+{
+    //- A matrix whose row lengths follow a power law: two rows hold most of the elements, and
+    //  so span the parts of several threads, and a quarter of the rows are empty.
+    //
+    size_t const    rows = 3000;
+    size_t const    cols = 600000;
+
+    std::vector<size_t>     offsets{0};
+    std::vector<size_t>     indices;
+    std::vector<double>     values;
+
+    for (size_t i = 0;  i < rows;  ++i)
+    {
+        size_t const    n = (i == 5) ? cols : (i == 17) ? 400000 : (i % 10 == 0) ? 1000 : i % 4;
+
+        for (size_t k = 0;  k < n;  ++k)
+        {
+            indices.push_back((n == cols) ? k : (k * 599 + i) % cols);
+            values.push_back(static_cast<double>((i + k) % 5) - 2.0);
+        }
+        std::sort(indices.end() - static_cast<ptrdiff_t>(n), indices.end());
+        offsets.push_back(indices.size());
+    }
+
+    smd     s(sparse_matrix_engine<double>(rows, cols, offsets, indices, values));
+    dcvd    x(cols);
+    dmd     b(cols, 3);
+
+    fill_dense_operand(x, 1);
+    fill_dense_operand(b, 2);
+
+    //- The serial kernel is the reference; the elements are small integers, so the sums are
+    //  exact in any order.
+    //
+    using kernel_type   = sparse_kernel<double, size_t>;
+    using parallel_type = parallel_sparse_kernel<double, size_t>;
+
+    auto const  a = make_csr_operand(s.engine());
+    dcvd        y0(rows);
+    dmd         c0(rows, 3);
+
+    kernel_type::multiply(a, x.span().data_handle(), 1, y0.span().data_handle(), 1);
+    kernel_type::multiply(a, make_dense_operand(b.span()), make_dense_operand(c0.span()));
+
+    for (size_t threads : {1, 2, 3, 7, 16})
+    {
+        dcvd    y(rows);
+        dmd     c(rows, 3);
+
+        parallel_type::multiply(a, x.span().data_handle(), 1, y.span().data_handle(), 1, threads);
+        parallel_type::multiply(a, make_dense_operand(b.span()), make_dense_operand(c.span()), threads);
+
+        EXPECT_EQ(y, y0);
+        EXPECT_EQ(c, c0);
+    }
+
+    EXPECT_EQ(s * x, y0);
+    EXPECT_EQ(s * b, c0);
+}
+
+TEST(Sparse, SELL)
+{
+    //- Rows of lengths 1, 3, 1, 3, in slices of two rows.  Without sorting, each slice is three
+    //  elements wide; sorting the four rows by length places the two long rows in one slice.
+    //
+    using sle_2 = sliced_ellpack_engine<double, size_t, std::allocator<double>, 2>;
+
+    dmd     d1 = {{1, 0, 0, 0}, {2, 3, 4, 0}, {0, 0, 0, 5}, {0, 6, 7, 8}};
+    smd     s1(d1);
+
+    matrix<sle_2>   e1(sle_2(s1.engine(), 1));
+    matrix<sle_2>   e2(sle_2(s1.engine(), 4));
+
+    PRINT(e2);
+    EXPECT_EQ(e1, d1);
+    EXPECT_EQ(e2, d1);
+    EXPECT_EQ(e2.engine().nonzeros(), 8u);
+    EXPECT_EQ(e1.engine().values().size(), 12u);
+    EXPECT_EQ(e2.engine().values().size(), 8u);
+    EXPECT_EQ(e2.engine().slices(), 2u);
+
+    std::vector<size_t> const   permutation{1, 3, 0, 2};
+    std::vector<size_t> const   indices{0, 1, 1, 2, 2, 3, 0, 3};
+    std::vector<double> const   values{2, 6, 3, 7, 4, 8, 1, 5};
+
+    EXPECT_TRUE(std::ranges::equal(e2.engine().row_permutation(), permutation));
+    EXPECT_TRUE(std::ranges::equal(e2.engine().column_indices(), indices));
+    EXPECT_TRUE(std::ranges::equal(e2.engine().values(), values));
+
+    //- The sorting scope must be 1 or a whole number of slices.
+    //
+    EXPECT_THROW(sle_2(s1.engine(), 0), runtime_error);
+    EXPECT_THROW(sle_2(s1.engine(), 3), runtime_error);
+    EXPECT_EQ(matrix<sle_2>(sle_2(5, 3)), dmd(5, 3));
+
+    //- Products agree with CSR for several slice heights, index types, and sorting scopes; the
+    //  elements are small integers, so the sums are exact in any order.  Every tenth row is
+    //  long, so that the slices vary in width.
+    //
+    dmd     d(300, 250);
+    dcvd    x(250);
+    dmd     b(250, 7);
+    cmd     bc(250, 7);
+
+    fill_sparse_operand(d, 1);
+    fill_dense_operand(x, 2);
+    fill_dense_operand(b, 3);
+    fill_dense_operand(bc, 3);
+
+    for (ptrdiff_t i = 0;  i < 300;  i += 10)
+    {
+        for (ptrdiff_t j = 0;  j < 250;  j += 3)
+        {
+            d(i, j) = static_cast<double>(j % 5) - 2.0;
+        }
+    }
+
+    dmd     xt = x.t();
+    smd     s(d);
+    dcvd    y = s * x;
+    dmd     c = s * b;
+
+    auto    check = [&]<class ET>(matrix<ET> const& e)
+    {
+        EXPECT_EQ(e, d);
+        EXPECT_EQ(e * x, y);
+        EXPECT_EQ(e * xt.t(), y);
+        EXPECT_EQ(e * b, c);
+        EXPECT_EQ(e * bc, c);
+    };
+
+    check(sld(d));
+    check(sld_32(s));
+    check(matrix<sle_2>(sle_2(s.engine(), 1)));
+    check(matrix<sliced_ellpack_engine<double, int, std::allocator<double>, 4>>(d));
+    check(matrix<sliced_ellpack_engine<double, size_t, std::allocator<double>, 3>>(d));
+
+    dmf     df(d);
+    dmf     bf(b);
+
+    using slf    = sliced_ellpack_matrix<float>;
+    using slf_32 = sliced_ellpack_matrix<float, uint32_t>;
+
+    EXPECT_EQ(slf(s) * bf, df * bf);
+    EXPECT_EQ(slf_32(s) * bf, df * bf);
+
+    //- Padding has column index zero, but is never multiplied by x; here column zero is empty,
+    //  so x(0) does not contribute to any row.
+    //
+    for (ptrdiff_t i = 0;  i < 300;  ++i)
+    {
+        d(i, 0) = 0.0;
+    }
+    x(0) = std::numeric_limits<double>::infinity();
+
+    EXPECT_EQ(sld(d) * x, smd(d) * x);
+    EXPECT_EQ(sld_32(d) * x, smd(d) * x);
+
+    //- Mis-matched extents are an error.
+    //
+    EXPECT_THROW(sld(d) * dcvd(249), runtime_error);
+}
+
+template<class T, class IT, size_t C>
+void
+check_sell_kernels(size_t rows, size_t cols)
+{
+    using engine_type = sliced_ellpack_engine<T, IT, std::allocator<T>, C>;
+    using kernel_type = sell_kernel<T, IT, C>;
+    using table_type  = simd_sell_slice_kernel<T, IT, C>;
+
+    dynamic_matrix<T>           d(rows, cols);
+    dynamic_column_vector<T>    x(cols);
+
+    fill_sparse_operand(d, 4);
+    fill_dense_operand(x, 5);
+
+    for (size_t i = 0;  i < rows;  i += 7)
+    {
+        for (size_t j = i % 3;  j < cols;  j += 5)
+        {
+            d(i, j) = static_cast<T>(j % 7) - T{3};
+        }
+    }
+
+    engine_type const   e(d);
+    auto const          a = make_sell_operand(e);
+    std::vector<T>      y0(rows);
+
+    kernel_type::generic_multiply(a, 0, a.slices, x.span().data_handle(), y0.data(), 1);
+
+    for (simd_isa isa : {simd_isa::sse2, simd_isa::avx2, simd_isa::avx512})
+    {
+        if (not cpu_features::supports(isa)) continue;
+
+        auto const      sk = table_type::for_isa(isa, {&kernel_type::generic_multiply});
+        std::vector<T>  y1(rows);
+
+        sk.multiply(a, 0, a.slices, x.span().data_handle(), y1.data(), 1);
+        EXPECT_EQ(y1, y0);
+    }
+
+    for (size_t threads : {1, 2, 3, 7})
+    {
+        std::vector<T>  y2(rows);
+
+        kernel_type::multiply(a, x.span().data_handle(), 1, y2.data(), 1, threads);
+        EXPECT_EQ(y2, y0);
+    }
+}
+
+TEST(Sparse, SellKernels)
+{
+    //- The first is large enough to be divided among several threads.
+    //
+    check_sell_kernels<double, size_t, 8>(6001, 2000);
+    check_sell_kernels<double, uint32_t, 8>(501, 300);
+    check_sell_kernels<double, int64_t, 4>(501, 300);
+    check_sell_kernels<float, uint32_t, 16>(501, 300);
+    check_sell_kernels<float, int32_t, 8>(501, 300);
+}